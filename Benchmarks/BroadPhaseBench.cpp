@@ -0,0 +1,258 @@
+/// \file BroadPhaseBench.cpp
+/// \brief Benchmark for the uniform grid broad phase in `CObjectManager`.
+///
+/// Scatters 100, 1k and 10k slimes over the floor of the boss map, with a
+/// king slime among them, and finds the pairs whose bounding circles overlap
+/// twice, once the way `LBaseObjectManager::BroadPhase()` did, testing every
+/// pair of objects, and once with a copy of the grid that
+/// `CObjectManager::BroadPhase()` bins moving objects into. The grid is
+/// sized from the tile size as it is in the game, so cells are 2 tiles wide.
+/// Reports the number of pair tests and the time each took, and checks that
+/// the grid finds the same number of overlapping pairs as the all-pairs
+/// test does, so that it neither misses a pair nor finds one twice.
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "PhysicsStore.h"
+
+#define private public //reach the map for the floor tiles
+#include "TileManager.h"
+#undef private
+
+/// \brief A game object as far as the broad phase is concerned.
+
+class CObject{
+  public:
+    Vector2 m_vPos; ///< Position.
+    float m_fRadius = 16.0f; ///< Bounding circle radius.
+    UINT m_nSlot = CPhysicsStore::NONE; ///< Physics store slot.
+}; //CObject
+
+/// Test whether two objects' bounding circles overlap, the way
+/// `CObjectManager::NarrowPhase()` does.
+/// \param p0 Pointer to an object.
+/// \param p1 Pointer to another object.
+/// \return true if they overlap.
+
+static bool Overlap(const CObject* p0, const CObject* p1){
+  return p0->m_fRadius + p1->m_fRadius - (p0->m_vPos - p1->m_vPos).Length() > 0.0f;
+} //Overlap
+
+/// \brief The moving object part of the object manager's broad phase, copied
+/// from `CObjectManager::SizeGrid()`, `CObjectManager::BuildGrid()` and
+/// `CObjectManager::BroadPhase()`, with the store to itself.
+
+class CObjectManager: public CCommon{
+  public:
+    CPhysicsStore m_cPhysics; ///< Physics store.
+
+    std::vector<std::vector<UINT>> m_vecCells; ///< Slots of moving objects in each grid cell.
+    std::vector<size_t> m_vecOccupied; ///< Indices of non-empty grid cells.
+    std::vector<UINT> m_vecLarge; ///< Slots of moving objects too big for a cell.
+    size_t m_nGridWidth = 0; ///< Number of grid cells wide.
+    size_t m_nGridHeight = 0; ///< Number of grid cells high.
+    float m_fCellSize = 0.0f; ///< Grid cell width and height.
+
+    /// Size the grid from the tile size and world size.
+
+    void SizeGrid(){
+      m_fCellSize = 2.0f*m_pTileManager->GetTileSize();
+      const size_t w = std::max<size_t>(1, (size_t)ceilf(m_vWorldSize.x/m_fCellSize));
+      const size_t h = std::max<size_t>(1, (size_t)ceilf(m_vWorldSize.y/m_fCellSize));
+
+      if(w != m_nGridWidth || h != m_nGridHeight){ //world size changed
+        m_nGridWidth = w;
+        m_nGridHeight = h;
+        m_vecCells.clear();
+        m_vecCells.resize(w*h);
+        m_vecOccupied.clear();
+      } //if
+    } //SizeGrid
+
+    /// Bin the live slots into grid cells.
+
+    void BuildGrid(){
+      for(const size_t n: m_vecOccupied) //empty cells from last time
+        m_vecCells[n].clear();
+
+      m_vecOccupied.clear();
+      m_vecLarge.clear();
+      SizeGrid();
+
+      const size_t w = m_nGridWidth; //shorthand
+      const size_t h = m_nGridHeight; //shorthand
+      const CPhysicsStore& s = m_cPhysics; //shorthand
+      const UINT nSlots = (UINT)s.GetSize(); //number of slots
+
+      for(UINT k=0; k<nSlots; k++){ //for each slot
+        if(2.0f*s.m_vecRadius[k] > m_fCellSize){ //too big for a cell
+          m_vecLarge.push_back(k);
+          continue;
+        } //if
+
+        const int i = std::min<int>(std::max<int>((int)floorf(s.m_vecPosX[k]/m_fCellSize), 0), (int)w - 1);
+        const int j = std::min<int>(std::max<int>((int)floorf(s.m_vecPosY[k]/m_fCellSize), 0), (int)h - 1);
+        const size_t n = j*w + i; //cell index
+
+        if(m_vecCells[n].empty())
+          m_vecOccupied.push_back(n);
+
+        m_vecCells[n].push_back(k);
+      } //for
+    } //BuildGrid
+
+    /// Call a function on each pair of slots in the same cell or neighbouring
+    /// cells, and on each pair with a large object in it.
+    /// \param f Function taking the two slots of a pair.
+
+    template<class F> void ForEachPair(F f){
+      static const int dx[4] = {1, -1, 0, 1}; //neighbour column offsets
+      static const int dy[4] = {0,  1, 1, 1}; //neighbour row offsets
+
+      for(const size_t n: m_vecOccupied){ //for each occupied cell
+        const std::vector<UINT>& cell = m_vecCells[n];
+        const int i = (int)(n % m_nGridWidth); //column
+        const int j = (int)(n / m_nGridWidth); //row
+
+        for(size_t a=0; a<cell.size(); a++){
+          for(size_t b=a + 1; b<cell.size(); b++) //same cell
+            f(cell[a], cell[b]);
+
+          for(int k=0; k<4; k++){ //neighbouring cells
+            const int ni = i + dx[k];
+            const int nj = j + dy[k];
+
+            if(ni >= 0 && ni < (int)m_nGridWidth && nj < (int)m_nGridHeight)
+              for(const UINT m: m_vecCells[nj*m_nGridWidth + ni])
+                f(cell[a], m);
+          } //for
+        } //for
+      } //for
+
+      for(size_t a=0; a<m_vecLarge.size(); a++){ //large objects against everything
+        for(size_t b=a + 1; b<m_vecLarge.size(); b++)
+          f(m_vecLarge[a], m_vecLarge[b]);
+
+        for(const size_t n: m_vecOccupied)
+          for(const UINT k: m_vecCells[n])
+            f(m_vecLarge[a], k);
+      } //for
+    } //ForEachPair
+
+    /// Give an object a slot and gather it into the store, as
+    /// `CObjectManager::create()` and `CObjectManager::Gather()` do.
+    /// \param p Pointer to an object.
+
+    void Add(CObject* p){
+      const UINT n = p->m_nSlot = m_cPhysics.Alloc(p);
+      m_cPhysics.m_vecPosX[n] = p->m_vPos.x;
+      m_cPhysics.m_vecPosY[n] = p->m_vPos.y;
+      m_cPhysics.m_vecRadius[n] = p->m_fRadius;
+    } //Add
+
+    /// Reader function for the object in a slot.
+    /// \param n Slot number.
+    /// \return Pointer to the object in slot n.
+
+    CObject* GetObject(UINT n) const{
+      return m_cPhysics.m_vecObject[n];
+    } //GetObject
+
+    /// Writer function for the tile manager.
+    /// \param p Pointer to a tile manager.
+
+    static void SetTileManager(CTileManager* p){
+      m_pTileManager = p;
+    } //SetTileManager
+}; //CObjectManager
+
+int main(int argc, char* argv[]){
+  const std::string dir = argc > 1? argv[1]: "../Media/Maps/"; //map folder
+  const std::string ground = dir + "boss.txt";
+  const int TRIALS = 5; //number of frames to time
+
+  CTileManager tm(32); //wall sprites are 32 pixels
+  std::vector<char> a(ground.begin(), ground.end());
+  a.push_back(0);
+  tm.LoadMap(a.data(), a.data(), a.data(), a.data(), 0); //walls only depend on the ground map
+  CObjectManager::SetTileManager(&tm);
+
+  const float t = tm.GetTileSize();
+  std::vector<Vector2> floor; //floor tile corners
+
+  for(size_t i=0; i<tm.m_nHeight; i++)
+    for(size_t j=0; j<tm.m_nWidth; j++)
+      if(!(tm.At(i, j).m_nFlags & STile::SOLID))
+        floor.push_back(t*Vector2((float)j, (float)(tm.m_nHeight - 1 - i)));
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+  using clock = std::chrono::high_resolution_clock;
+  auto ms = [](clock::time_point a, clock::time_point b){
+    return std::chrono::duration<double, std::milli>(b - a).count()/TRIALS;
+  }; //ms
+
+  size_t failures = 0; //slime counts where the overlaps differ
+
+  printf("boss map, %zux%zu tiles of %.0f pixels, mean of %d frames\n",
+    tm.m_nWidth, tm.m_nHeight, t, TRIALS);
+  printf("%7s %12s %10s %10s %10s %10s %10s\n",
+    "slimes", "all pairs", "ms", "grid pairs", "ms", "overlaps", "grid");
+
+  for(size_t n: {100, 1000, 10000}){
+    std::vector<CObject*> obj(n); //the object list
+    CObjectManager om;
+
+    for(size_t i=0; i<n; i++){
+      CObject* p = obj[i] = new CObject;
+      p->m_vPos = floor[gen()%floor.size()] + t*Vector2(unit(gen), unit(gen));
+      p->m_fRadius = i == 0? 102.4f: i%8 == 0? 32.0f: 16.0f; //a king slime, big slimes and slimes
+      om.Add(p);
+    } //for
+
+    //old: every pair in the object list
+
+    size_t nAll = 0, nAllHits = 0; //pair tests and overlaps
+
+    auto t0 = clock::now();
+    for(int k=0; k<TRIALS; k++){
+      nAll = nAllHits = 0;
+
+      for(size_t i=0; i<n; i++)
+        for(size_t j=i + 1; j<n; j++){
+          nAll++;
+          if(Overlap(obj[i], obj[j]))nAllHits++;
+        } //for
+    } //for
+    auto t1 = clock::now();
+
+    //new: pairs in neighbouring grid cells
+
+    size_t nGrid = 0, nGridHits = 0; //pair tests and overlaps
+
+    auto t2 = clock::now();
+    for(int k=0; k<TRIALS; k++){
+      nGrid = nGridHits = 0;
+      om.BuildGrid();
+
+      om.ForEachPair([&](UINT n0, UINT n1){
+        nGrid++;
+        if(Overlap(om.GetObject(n0), om.GetObject(n1)))nGridHits++;
+      }); //ForEachPair
+    } //for
+    auto t3 = clock::now();
+
+    printf("%7zu %12zu %10.3f %10zu %10.3f %10zu %10zu\n",
+      n, nAll, ms(t0, t1), nGrid, ms(t2, t3), nAllHits, nGridHits);
+
+    if(nAllHits != nGridHits)failures++;
+
+    for(CObject* p: obj)delete p;
+  } //for
+
+  return failures == 0? 0: 1;
+} //main
@@ -0,0 +1,167 @@
+/// \file ObjectListBench.cpp
+/// \brief Benchmark for the object manager's dense object list.
+///
+/// Runs 2000 frames of 10k heap-allocated objects, once in a `std::list` of
+/// pointers culled by erasing dead nodes in place, the way
+/// `LBaseObjectManager` did, and once in a `std::vector` of pointers
+/// compacted in one pass, the way `CObjectManager::CullDeadObjects()` does.
+/// Each frame calls a virtual `move()` on every object, about 1% of which
+/// die, and replaces the dead with new objects at the back of the list.
+/// Objects are padded and allocated among other allocations, so that they
+/// are scattered over the heap as they are in the game. Reports the time
+/// spent iterating and culling, and checks that both lists end up holding
+/// the same objects in the same order.
+
+#include <chrono>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "Defines.h"
+
+/// \brief A game object as far as the object list is concerned. The padding
+/// stands in for the rest of `CObject` and its sprite descriptor, so that
+/// each object is about as far from the next as it is in the game.
+
+class CObject{
+  public:
+    char m_cSprite[96] = {0}; ///< Stands in for the sprite descriptor.
+    Vector2 m_vPos; ///< Position.
+    Vector2 m_vVelocity; ///< Velocity.
+    UINT m_nID = 0; ///< Order of creation.
+    bool m_bDead = false; ///< Marked for deletion.
+    char m_cRest[160] = {0}; ///< Stands in for the rest of the object.
+
+    /// Constructor.
+    /// \param n Order of creation.
+
+    explicit CObject(UINT n): m_vVelocity((float)(n%7), (float)(n%5)), m_nID(n){}
+
+    virtual ~CObject(){}
+
+    /// Move, and die on about 1% of frames.
+    /// \param frame Frame number.
+
+    virtual void move(UINT frame){
+      m_vPos += m_vVelocity/60.0f;
+      m_bDead = (m_nID*2654435761U + frame*40503U) % 200 == 0;
+    } //move
+}; //CObject
+
+/// \brief An object list and the other allocations made with it.
+
+template<class List> struct SWorld{
+  List m_cList; ///< Object list.
+  std::vector<char*> m_vecClutter; ///< Other heap allocations between objects.
+  std::mt19937 m_cGen; ///< Random number generator for clutter sizes.
+  UINT m_nNext = 0; ///< Order of creation of the next object.
+
+  /// Constructor.
+
+  SWorld(): m_cGen(1){}
+
+  /// Destructor.
+
+  ~SWorld(){
+    for(CObject* p: m_cList)delete p;
+    for(char* p: m_vecClutter)delete [] p;
+  } //destructor
+
+  /// Create an object at the back of the list, with another allocation
+  /// after it.
+
+  void Create(){
+    m_cList.push_back(new CObject(m_nNext++));
+    m_vecClutter.push_back(new char[16 + m_cGen()%512]);
+  } //Create
+}; //SWorld
+
+int main(){
+  const size_t N = 10000; //number of objects
+  const UINT FRAMES = 2000; //number of frames
+
+  using clock = std::chrono::high_resolution_clock;
+  auto ms = [](clock::time_point a, clock::time_point b){
+    return std::chrono::duration<double, std::milli>(b - a).count();
+  }; //ms
+
+  SWorld<std::list<CObject*>> old; //the old object list
+  SWorld<std::vector<CObject*>> now; //the new object list
+
+  for(size_t i=0; i<N; i++){ //interleaved, so both are scattered alike
+    old.Create();
+    now.Create();
+  } //for
+
+  double tOldMove = 0, tOldCull = 0, tNewMove = 0, tNewCull = 0; //total times
+  size_t nDied = 0; //number of objects that died
+  std::vector<CObject*> dead; //scratch list of dead objects
+
+  for(UINT f=0; f<FRAMES; f++){
+    //old: a linked list, erased in place
+
+    auto t0 = clock::now();
+    for(CObject* p: old.m_cList)
+      p->move(f);
+    auto t1 = clock::now();
+
+    size_t nOld = 0; //number that died
+
+    for(auto i=old.m_cList.begin(); i!=old.m_cList.end();)
+      if((*i)->m_bDead){
+        delete *i;
+        i = old.m_cList.erase(i);
+        nOld++;
+      } //if
+
+      else ++i;
+    auto t2 = clock::now();
+
+    //new: a vector, compacted in one pass
+
+    auto t3 = clock::now();
+    for(size_t i=0; i<now.m_cList.size(); i++)
+      now.m_cList[i]->move(f);
+    auto t4 = clock::now();
+
+    std::vector<CObject*>& v = now.m_cList; //shorthand
+    size_t n = 0; //number of live objects
+
+    for(CObject* p: v)
+      if(p->m_bDead)dead.push_back(p);
+      else v[n++] = p;
+
+    v.resize(n);
+
+    for(CObject* p: dead)
+      delete p;
+
+    const size_t nNew = dead.size(); //number that died
+    dead.clear();
+    auto t5 = clock::now();
+
+    tOldMove += ms(t0, t1);
+    tOldCull += ms(t1, t2);
+    tNewMove += ms(t3, t4);
+    tNewCull += ms(t4, t5);
+    nDied += nOld;
+
+    for(size_t i=0; i<nOld; i++)old.Create(); //replace the dead
+    for(size_t i=0; i<nNew; i++)now.Create();
+  } //for
+
+  //both lists must hold the same objects in the same order
+
+  bool bSame = old.m_cList.size() == now.m_cList.size();
+  auto i = old.m_cList.begin();
+
+  for(size_t k=0; bSame && k<now.m_cList.size(); k++, i++)
+    bSame = (*i)->m_nID == now.m_cList[k]->m_nID;
+
+  printf("%zu objects, %u frames, %zu died and were replaced\n", N, FRAMES, nDied);
+  printf("  std::list    move %7.1f ms  cull %7.1f ms\n", tOldMove, tOldCull);
+  printf("  std::vector  move %7.1f ms  cull %7.1f ms\n", tNewMove, tNewCull);
+  printf("  lists %s\n", bSame? "match": "differ");
+
+  return bSame? 0: 1;
+} //main
@@ -0,0 +1,176 @@
+/// \file ParticleBench.cpp
+/// \brief Benchmark for `CParticleStore::step`.
+///
+/// Creates 50k and 200k particles and steps them with the particle store,
+/// and with a scalar loop over one descriptor per particle that does what
+/// the engine's particle engine does each frame, dividing by the lifespan
+/// and curve fractions every time. The particles are spread over a world
+/// much larger than the window, so the budget thins out some of the far
+/// ones, which neither loop steps, and `Draw()` culls most of the rest.
+/// Finally checks that creating particles in a batch admits the same ones
+/// as creating them one at a time, and that dead particles are compacted
+/// away.
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "ParticleStore.h"
+#include "SpriteRenderer.h"
+
+/// \brief Gives the benchmark access to the renderer pointer that the game
+/// sets up in `CGame::Initialize()`.
+
+class CBench: public CCommon{
+  public:
+    /// Writer function for the renderer.
+    /// \param p Pointer to a renderer.
+
+    static void SetRenderer(LSpriteRenderer* p){
+      m_pRenderer = p;
+    } //SetRenderer
+}; //CBench
+
+/// \brief A particle in the engine's particle engine, more or less.
+
+struct SOldParticle{
+  LParticleDesc2D m_cDesc; ///< Descriptor.
+  float m_fBirthTime = 0.0f; ///< Time of creation.
+}; //SOldParticle
+
+/// Value of a scale or fade curve, the way the engine computes it.
+/// \param f Fraction of life so far.
+/// \param in Fraction of life spent ramping up.
+/// \param out Fraction of life spent ramping down.
+/// \return Curve value.
+
+static float OldCurve(float f, float in, float out){
+  if(in > 0.0f && f < in)return f/in;
+  if(out > 0.0f && f > 1.0f - out)return (1.0f - f)/out;
+  return 1.0f;
+} //OldCurve
+
+int main(){
+  const int STEPS = 200; //number of steps
+  const float dt = 1.0f/60.0f; //frame time
+
+  LSpriteRenderer renderer;
+  renderer.SetCameraPos(Vector3(512.0f, 384.0f, 0.0f));
+  CBench::SetRenderer(&renderer);
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+  using clock = std::chrono::high_resolution_clock;
+  auto ms = [](clock::time_point a, clock::time_point b){
+    return std::chrono::duration<double, std::milli>(b - a).count()/STEPS;
+  }; //ms
+
+  size_t nBad = 0; //batches that admit different particles
+
+  for(size_t n: {50000, 200000}){
+    CParticleStore store;
+    store.GetBudget().SetBudget(2*n); //well clear of downsampling
+    store.GetBudget().SetQuota(eParticleCategory::Combat, 2*n, 0);
+
+    std::vector<SOldParticle> old; //the particles admitted to the store
+    old.reserve(n);
+    std::vector<LParticleDesc2D> batch; //all of the particles created
+    batch.reserve(n);
+
+    for(size_t i=0; i<n; i++){
+      LParticleDesc2D d;
+      d.m_vPos = Vector2(4000.0f*unit(gen) - 1500.0f, 4000.0f*unit(gen) - 1500.0f);
+      d.m_vVel = Vector2(5.0f + 5.0f*unit(gen), 5.0f + 5.0f*unit(gen)); //fast enough to reach the window
+      d.m_fLifeSpan = 1000.0f;
+      d.m_fMaxScale = 0.5f;
+      d.m_fScaleInFrac = 0.1f;
+      d.m_fFadeInFrac = 0.2f;
+      d.m_fFadeOutFrac = 0.8f;
+
+      const size_t size = store.GetSize();
+      store.create(d, eParticleCategory::Combat);
+      batch.push_back(d);
+
+      if(store.GetSize() > size){
+        old.emplace_back();
+        old.back().m_cDesc = d;
+      } //if
+    } //for
+
+    //new: the particle store
+
+    auto t0 = clock::now();
+    for(int k=0; k<STEPS; k++)
+      store.step(dt);
+    auto t1 = clock::now();
+
+    //old: scalar, one descriptor per particle
+
+    float t = 0.0f; //current time
+
+    auto t2 = clock::now();
+    for(int k=0; k<STEPS; k++){
+      t += dt;
+
+      for(SOldParticle& p: old){
+        LParticleDesc2D& d = p.m_cDesc;
+        d.m_vPos += d.m_vVel*dt;
+
+        const float f = (t - p.m_fBirthTime)/d.m_fLifeSpan; //fraction of life
+        d.m_fXScale = d.m_fYScale = d.m_fMaxScale*OldCurve(f, d.m_fScaleInFrac, d.m_fScaleOutFrac);
+        d.m_fAlpha = OldCurve(f, d.m_fFadeInFrac, d.m_fFadeOutFrac);
+      } //for
+    } //for
+    auto t3 = clock::now();
+
+    //the same particles one at a time and in one batch, with a budget too
+    //large to thin any out, since thinning draws random numbers
+
+    CParticleStore single, batched;
+
+    for(CParticleStore* p: {&single, &batched}){
+      p->GetBudget().SetBudget(10*n);
+      p->GetBudget().SetQuota(eParticleCategory::Combat, 10*n, 0);
+    } //for
+
+    for(const LParticleDesc2D& d: batch)
+      single.create(d, eParticleCategory::Combat);
+
+    batched.create(batch.data(), batch.size(), eParticleCategory::Combat);
+
+    if(batched.GetSize() != single.GetSize())
+      nBad++;
+
+    store.Draw();
+
+    float sum = 0.0f; //checksum, so the old loop can't be skipped
+    for(const SOldParticle& p: old)
+      sum += p.m_cDesc.m_fAlpha + p.m_cDesc.m_vPos.x;
+
+    printf("%zu particles created, %zu admitted, mean of %d steps\n", n, store.GetSize(), STEPS);
+    printf("  scalar step over descriptors      %.3f ms\n", ms(t2, t3));
+    printf("  CParticleStore::step()            %.3f ms\n", ms(t0, t1));
+    printf("  drawn %zu, checksum %.1f\n", store.GetNumDrawn(), sum);
+    printf("  without thinning, %zu admitted one at a time and %zu in one batch\n",
+      single.GetSize(), batched.GetSize());
+  } //for
+
+  //dead particles are compacted away
+
+  CParticleStore store;
+
+  for(int i=0; i<10; i++){
+    LParticleDesc2D d;
+    d.m_vPos = Vector2(512.0f, 384.0f);
+    d.m_fLifeSpan = 0.1f*(i + 1);
+    store.create(d, eParticleCategory::Combat);
+  } //for
+
+  for(int k=0; k<120; k++)
+    store.step(0.01f);
+
+  printf("10 particles with lifespans up to 1s, %zu left after 1.2s\n", store.GetSize());
+
+  return store.GetSize() == 0 && nBad == 0? 0: 1;
+} //main
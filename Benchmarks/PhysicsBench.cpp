@@ -0,0 +1,174 @@
+/// \file PhysicsBench.cpp
+/// \brief Benchmark for `CPhysicsStore::Integrate`.
+///
+/// Integrates 50k bodies the way the object list used to, with a virtual
+/// `move()` on each heap-allocated object walked through a linked list, and
+/// with the physics store, both on its own and with the gather and scatter
+/// that `CObjectManager::move()` wraps around it. A tenth of the bodies are
+/// static, a fiftieth are dead, and a twentieth move themselves, like the
+/// player, rabites and oak seeds.
+
+#include <chrono>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "PhysicsStore.h"
+
+/// \brief A game object as far as integration is concerned. The padding
+/// stands in for the rest of `CObject` and its sprite descriptor, so that
+/// each object is about as far from the next as it is in the game.
+
+class CObject{
+  public:
+    char m_cSprite[96] = {0}; ///< Stands in for the sprite descriptor.
+    Vector2 m_vPos; ///< Position.
+    Vector2 m_vVelocity; ///< Velocity.
+    float m_fRadius = 16.0f; ///< Bounding circle radius.
+    bool m_bStatic = false; ///< Does not move.
+    bool m_bDead = false; ///< Marked for deletion.
+    bool m_bIsTarget = true; ///< Is a target.
+    bool m_bIntegrate = true; ///< Position integrated by the store.
+    bool m_bFixed = false; ///< In the static grid.
+    UINT m_nSlot = CPhysicsStore::NONE; ///< Physics store slot.
+    char m_cRest[160] = {0}; ///< Stands in for the rest of the object.
+
+    virtual ~CObject(){}
+
+    /// Integrate, as `CObject::move()` did before the physics store.
+    /// \param t Frame time.
+
+    virtual void move(float t){
+      if(!m_bDead && !m_bStatic)
+        m_vPos += m_vVelocity*t;
+    } //move
+}; //CObject
+
+/// \brief The object manager's gather and scatter, which have access to the
+/// store's arrays.
+
+class CObjectManager{
+  public:
+    /// Copy object data into the store, as `CObjectManager::Gather()` does.
+
+    static void Gather(CPhysicsStore& s, const std::vector<CObject*>& v){
+      for(CObject* pObj: v){
+        const UINT n = pObj->m_nSlot;
+        s.m_vecPosX[n] = pObj->m_vPos.x;
+        s.m_vecPosY[n] = pObj->m_vPos.y;
+        s.m_vecVelX[n] = pObj->m_vVelocity.x;
+        s.m_vecVelY[n] = pObj->m_vVelocity.y;
+        s.m_vecRadius[n] = pObj->m_fRadius;
+        s.m_vecFlags[n] = CPhysicsStore::LIVE |
+          (pObj->m_bStatic?    CPhysicsStore::STATIC: 0) |
+          (pObj->m_bDead?      CPhysicsStore::DEAD: 0) |
+          (pObj->m_bIsTarget?  CPhysicsStore::TARGET: 0) |
+          (pObj->m_bIntegrate? CPhysicsStore::INTEGRATE: 0) |
+          (pObj->m_bFixed?     CPhysicsStore::FIXED: 0);
+      } //for
+    } //Gather
+
+    /// Copy positions back, as `CObjectManager::Scatter()` does.
+
+    static void Scatter(const CPhysicsStore& s, const std::vector<CObject*>& v){
+      for(CObject* pObj: v){
+        const UINT n = pObj->m_nSlot;
+        if(s.m_vecFlags[n] & CPhysicsStore::INTEGRATE)
+          pObj->m_vPos = Vector2(s.m_vecPosX[n], s.m_vecPosY[n]);
+      } //for
+    } //Scatter
+
+    /// Checksum of the store's positions, so the work can't be skipped.
+
+    static float Sum(const CPhysicsStore& s){
+      float sum = 0.0f;
+      for(size_t i=0; i<s.m_vecPosX.size(); i++)
+        sum += s.m_vecPosX[i] + s.m_vecPosY[i];
+      return sum;
+    } //Sum
+}; //CObjectManager
+
+int main(){
+  const size_t BODIES = 50000; //number of bodies
+  const int FRAMES = 1000; //number of frames
+  const float dt = 1.0f/60.0f; //frame time
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+  std::list<CObject*> list; //the old object list
+  std::vector<CObject*> vec; //the new object list
+  std::vector<char*> clutter; //other heap allocations between objects
+  CPhysicsStore store;
+
+  for(size_t i=0; i<BODIES; i++){
+    CObject* p = new CObject;
+    clutter.push_back(new char[16 + gen()%512]);
+
+    p->m_vPos = Vector2(4000.0f*unit(gen), 4000.0f*unit(gen));
+    p->m_vVelocity = Vector2(100.0f*unit(gen), 100.0f*unit(gen));
+    p->m_bStatic = i%10 == 0;
+    p->m_bDead = i%50 == 1;
+    p->m_bIntegrate = i%20 != 2;
+    p->m_nSlot = store.Alloc(p);
+
+    list.push_back(p);
+    vec.push_back(p);
+  } //for
+
+  std::vector<Vector2> start(BODIES); //starting positions
+
+  for(size_t i=0; i<BODIES; i++)
+    start[i] = vec[i]->m_vPos;
+
+  using clock = std::chrono::high_resolution_clock;
+  auto ms = [](clock::time_point a, clock::time_point b){
+    return std::chrono::duration<double, std::milli>(b - a).count()/FRAMES;
+  }; //ms
+
+  //old: virtual move on each object in a linked list
+
+  auto t0 = clock::now();
+  for(int f=0; f<FRAMES; f++)
+    for(CObject* p: list)
+      p->move(dt);
+  auto t1 = clock::now();
+
+  float sumOld = 0.0f;
+  for(size_t i=0; i<BODIES; i++){
+    if(vec[i]->m_bIntegrate)sumOld += vec[i]->m_vPos.x + vec[i]->m_vPos.y;
+    vec[i]->m_vPos = start[i];
+  } //for
+
+  //new: gather, integrate and scatter as the object manager does
+
+  auto t2 = clock::now();
+  for(int f=0; f<FRAMES; f++){
+    CObjectManager::Gather(store, vec);
+    store.Integrate(dt);
+    CObjectManager::Scatter(store, vec);
+  } //for
+  auto t3 = clock::now();
+
+  float sumNew = 0.0f;
+  for(size_t i=0; i<BODIES; i++)
+    if(vec[i]->m_bIntegrate)sumNew += vec[i]->m_vPos.x + vec[i]->m_vPos.y;
+
+  //new: integration alone
+
+  auto t4 = clock::now();
+  for(int f=0; f<FRAMES; f++)
+    store.Integrate(dt);
+  auto t5 = clock::now();
+
+  printf("%zu bodies, mean of %d frames\n", BODIES, FRAMES);
+  printf("  virtual move() over linked list   %.3f ms\n", ms(t0, t1));
+  printf("  gather + Integrate() + scatter    %.3f ms\n", ms(t2, t3));
+  printf("  Integrate() alone                 %.3f ms\n", ms(t4, t5));
+  printf("  checksums %.1f %.1f (%.1f)\n", sumOld, sumNew, CObjectManager::Sum(store));
+
+  for(CObject* p: vec)delete p;
+  for(char* p: clutter)delete [] p;
+
+  return 0;
+} //main
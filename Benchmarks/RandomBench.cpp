@@ -0,0 +1,105 @@
+/// \file RandomBench.cpp
+/// \brief Benchmark and checks for `CRandomStream`.
+///
+/// Times 16M random integers in [0, 31] and 16M random floats in [0, 1)
+/// from `std::mt19937`, which is what `LRandom` wraps, and from a random
+/// number stream one value at a time and filling an array. Then checks that
+/// the values stay in range, that two streams with the same seed and lane
+/// produce the same values, and that two streams with the same seed and
+/// different lanes don't.
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "RandomStream.h"
+
+int main(){
+  const size_t N = 1 << 24; //number of values
+  const int TRIALS = 3; //number of times to time each
+
+  std::vector<UINT> v(N); //integers
+  std::vector<float> f(N); //floats
+  double sum = 0.0; //checksum, so the work can't be skipped
+
+  std::mt19937 mt(42);
+  CRandomStream r(42, 1);
+
+  using clock = std::chrono::high_resolution_clock;
+  auto rate = [](clock::time_point a, clock::time_point b){
+    return N/std::chrono::duration<double, std::milli>(b - a).count()/1000.0;
+  }; //rate
+
+  printf("%zu values, millions per second\n", N);
+
+  for(int trial=0; trial<TRIALS; trial++){
+    std::uniform_int_distribution<UINT> ints(0, 31);
+    std::uniform_real_distribution<float> floats(0.0f, 1.0f);
+
+    auto t0 = clock::now();
+    for(size_t i=0; i<N; i++)v[i] = ints(mt);
+    auto t1 = clock::now();
+    for(UINT x: v)sum += x;
+
+    auto t2 = clock::now();
+    for(size_t i=0; i<N; i++)v[i] = r.randn(0, 31);
+    auto t3 = clock::now();
+    for(UINT x: v)sum += x;
+
+    auto t4 = clock::now();
+    r.FillInts(v.data(), N, 0, 31);
+    auto t5 = clock::now();
+    for(UINT x: v)sum += x;
+
+    auto t6 = clock::now();
+    for(size_t i=0; i<N; i++)f[i] = floats(mt);
+    auto t7 = clock::now();
+    for(float x: f)sum += x;
+
+    auto t8 = clock::now();
+    for(size_t i=0; i<N; i++)f[i] = r.randf();
+    auto t9 = clock::now();
+    for(float x: f)sum += x;
+
+    auto t10 = clock::now();
+    r.FillFloats(f.data(), N);
+    auto t11 = clock::now();
+    for(float x: f)sum += x;
+
+    printf("  ints   mt19937 %4.0f  randn() %4.0f  FillInts()   %4.0f\n",
+      rate(t0, t1), rate(t2, t3), rate(t4, t5));
+    printf("  floats mt19937 %4.0f  randf() %4.0f  FillFloats() %4.0f\n",
+      rate(t6, t7), rate(t8, t9), rate(t10, t11));
+  } //for
+
+  //ranges and reproducibility, with lengths that aren't a multiple of 4
+
+  const size_t M = 1003; //number of values
+  CRandomStream r0(7, 2), r1(7, 2), r2(7, 3);
+  std::vector<UINT> a(M), b(M), c(M);
+  std::vector<float> g(M);
+
+  r0.FillInts(a.data(), M, 5, 9);
+  r1.FillInts(b.data(), M, 5, 9);
+  r2.FillInts(c.data(), M, 5, 9);
+  r0.FillFloats(g.data(), M);
+
+  size_t nBad = 0; //values out of range
+  size_t nDiff = 0; //values that differ with the same seed and lane
+  size_t nSame = 0; //values that match with a different lane
+
+  for(size_t i=0; i<M; i++){
+    if(a[i] < 5 || a[i] > 9 || g[i] < 0.0f || g[i] >= 1.0f)nBad++;
+    if(a[i] != b[i])nDiff++;
+    if(a[i] == c[i])nSame++;
+  } //for
+
+  for(int i=0; i<1000; i++)
+    if(r0.randn(5, 9) != r1.randn(5, 9))nDiff++;
+
+  printf("%zu values out of range, %zu differ with the same seed and lane\n", nBad, nDiff);
+  printf("%zu of %zu match with another lane, about %zu by chance (checksum %.0f)\n",
+    nSame, M, M/5, sum);
+
+  return nBad == 0 && nDiff == 0 && nSame < M/2? 0: 1;
+} //main
@@ -0,0 +1,12 @@
+/// \file Abort.h
+/// \brief Stand-in for the engine's abort macro, for the benchmarks.
+
+#ifndef __L4RC_BENCH_ABORT_H__
+#define __L4RC_BENCH_ABORT_H__
+
+#include <cstdio>
+#include <cstdlib>
+
+#define ABORT(...) (fprintf(stderr, __VA_ARGS__), fputc('\n', stderr), exit(1))
+
+#endif //__L4RC_BENCH_ABORT_H__
@@ -0,0 +1,51 @@
+/// \file Component.h
+/// \brief Stand-in for the engine's component base, for the benchmarks.
+
+#ifndef __L4RC_BENCH_COMPONENT_H__
+#define __L4RC_BENCH_COMPONENT_H__
+
+#include <random>
+
+#include "Defines.h"
+
+/// \brief Timer whose time the benchmark sets.
+
+class LTimer{
+  private:
+    float m_fTime = 0.0f; ///< Current time in seconds.
+    float m_fFrameTime = 1.0f/60.0f; ///< Frame time in seconds.
+
+  public:
+    void Tick(float dt){m_fFrameTime = dt; m_fTime += dt;}
+    float GetTime() const{return m_fTime;}
+    float GetFrameTime() const{return m_fFrameTime;}
+}; //LTimer
+
+/// \brief Random number generator. The engine's generator is not in this
+/// tree, so a Mersenne twister with the standard distributions stands in.
+
+class LRandom{
+  private:
+    std::mt19937 m_cGen; ///< Generator.
+
+  public:
+    LRandom(UINT seed=0): m_cGen(seed){}
+    UINT randn(UINT i, UINT j){return std::uniform_int_distribution<UINT>(i, j)(m_cGen);}
+    float randf(){return std::uniform_real_distribution<float>(0.0f, 1.0f)(m_cGen);}
+
+    Vector2 randv(){
+      const float theta = XM_2PI*randf();
+      return Vector2(cosf(theta), sinf(theta));
+    } //randv
+}; //LRandom
+
+/// \brief Component base, giving access to the timer and random number
+/// generator.
+
+class LComponent{
+  protected:
+    static LTimer* m_pTimer; ///< Timer.
+    static LRandom* m_pRandom; ///< Random number generator.
+}; //LComponent
+
+#endif //__L4RC_BENCH_COMPONENT_H__
@@ -0,0 +1,10 @@
+/// \file ComponentIncludes.h
+/// \brief Stand-in for the engine's component includes, for the benchmarks.
+
+#ifndef __L4RC_BENCH_COMPONENTINCLUDES_H__
+#define __L4RC_BENCH_COMPONENTINCLUDES_H__
+
+#include "Component.h"
+#include "SpriteRenderer.h"
+
+#endif //__L4RC_BENCH_COMPONENTINCLUDES_H__
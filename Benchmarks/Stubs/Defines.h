@@ -0,0 +1,208 @@
+/// \file Defines.h
+/// \brief Stand-ins for the engine's basic types, for the benchmarks.
+///
+/// Just enough of `DirectX::SimpleMath` and `DirectXCollision` for the game
+/// code that the benchmarks compile to build and behave the same way. The
+/// collision tests follow the DirectX ones, including counting shapes that
+/// only touch as intersecting.
+
+#ifndef __L4RC_BENCH_DEFINES_H__
+#define __L4RC_BENCH_DEFINES_H__
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+
+typedef uint8_t UINT8;
+typedef uint32_t UINT;
+typedef uint64_t UINT64;
+
+static const float XM_PI = 3.141592654f;
+static const float XM_2PI = 6.283185307f;
+static const float XM_PIDIV2 = 1.570796327f;
+static const float XM_PIDIV4 = 0.785398163f;
+
+struct Vector3;
+
+/// \brief 2D vector.
+
+struct Vector2{
+  float x = 0.0f, y = 0.0f;
+
+  Vector2(){}
+  Vector2(float a, float b): x(a), y(b){}
+  Vector2(const Vector3&);
+
+  float Length() const{return sqrtf(x*x + y*y);}
+  float LengthSquared() const{return x*x + y*y;}
+  float Dot(const Vector2& v) const{return x*v.x + y*v.y;}
+
+  void Normalize(){
+    const float n = Length();
+    if(n > 0.0f){x /= n; y /= n;}
+  } //Normalize
+
+  Vector2& operator+=(const Vector2& v){x += v.x; y += v.y; return *this;}
+  Vector2& operator-=(const Vector2& v){x -= v.x; y -= v.y; return *this;}
+  Vector2& operator*=(const Vector2& v){x *= v.x; y *= v.y; return *this;}
+  Vector2& operator*=(float s){x *= s; y *= s; return *this;}
+  Vector2& operator/=(float s){x /= s; y /= s; return *this;}
+  Vector2 operator-() const{return Vector2(-x, -y);}
+  bool operator==(const Vector2& v) const{return x == v.x && y == v.y;}
+  bool operator!=(const Vector2& v) const{return !(*this == v);}
+
+  static const Vector2 Zero, One, UnitX, UnitY;
+}; //Vector2
+
+inline Vector2 operator+(Vector2 a, const Vector2& b){return a += b;}
+inline Vector2 operator-(Vector2 a, const Vector2& b){return a -= b;}
+inline Vector2 operator*(Vector2 a, const Vector2& b){return a *= b;}
+inline Vector2 operator*(Vector2 a, float s){return a *= s;}
+inline Vector2 operator*(float s, Vector2 a){return a *= s;}
+inline Vector2 operator/(Vector2 a, float s){return a /= s;}
+
+/// \brief 3D vector.
+
+struct Vector3{
+  float x = 0.0f, y = 0.0f, z = 0.0f;
+
+  Vector3(){}
+  Vector3(float a, float b, float c): x(a), y(b), z(c){}
+  explicit Vector3(const Vector2& v): x(v.x), y(v.y){}
+
+  Vector3& operator+=(const Vector3& v){x += v.x; y += v.y; z += v.z; return *this;}
+  Vector3& operator-=(const Vector3& v){x -= v.x; y -= v.y; z -= v.z; return *this;}
+  Vector3& operator*=(float s){x *= s; y *= s; z *= s; return *this;}
+
+  static const Vector3 Zero, One;
+}; //Vector3
+
+inline Vector3 operator+(Vector3 a, const Vector3& b){return a += b;}
+inline Vector3 operator-(Vector3 a, const Vector3& b){return a -= b;}
+inline Vector3 operator*(Vector3 a, float s){return a *= s;}
+inline Vector3 operator*(float s, Vector3 a){return a *= s;}
+
+inline Vector2::Vector2(const Vector3& v): x(v.x), y(v.y){}
+
+/// \brief Four floats.
+
+struct XMFLOAT4{
+  float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f;
+
+  XMFLOAT4(){}
+  XMFLOAT4(float a, float b, float c, float d): x(a), y(b), z(c), w(d){}
+}; //XMFLOAT4
+
+/// \brief Axially aligned bounding box.
+
+struct BoundingBox{
+  Vector3 Center;
+  Vector3 Extents = Vector3(1.0f, 1.0f, 1.0f);
+
+  static void CreateMerged(BoundingBox& out, const BoundingBox& a, const BoundingBox& b){
+    const Vector3 lo(std::min(a.Center.x - a.Extents.x, b.Center.x - b.Extents.x),
+      std::min(a.Center.y - a.Extents.y, b.Center.y - b.Extents.y),
+      std::min(a.Center.z - a.Extents.z, b.Center.z - b.Extents.z));
+    const Vector3 hi(std::max(a.Center.x + a.Extents.x, b.Center.x + b.Extents.x),
+      std::max(a.Center.y + a.Extents.y, b.Center.y + b.Extents.y),
+      std::max(a.Center.z + a.Extents.z, b.Center.z + b.Extents.z));
+    out.Center = 0.5f*(lo + hi);
+    out.Extents = 0.5f*(hi - lo);
+  } //CreateMerged
+
+  /// Corners in the same order as DirectX: front face counterclockwise
+  /// from bottom left, then the back face.
+
+  void GetCorners(Vector3* c) const{
+    static const float o[8][3] = {{-1,-1,1},{1,-1,1},{1,1,1},{-1,1,1},{-1,-1,-1},{1,-1,-1},{1,1,-1},{-1,1,-1}};
+    for(int i=0; i<8; i++)
+      c[i] = Vector3(Center.x + o[i][0]*Extents.x, Center.y + o[i][1]*Extents.y, Center.z + o[i][2]*Extents.z);
+  } //GetCorners
+
+  bool Intersects(const BoundingBox& b) const{
+    return fabsf(Center.x - b.Center.x) <= Extents.x + b.Extents.x &&
+      fabsf(Center.y - b.Center.y) <= Extents.y + b.Extents.y &&
+      fabsf(Center.z - b.Center.z) <= Extents.z + b.Extents.z;
+  } //Intersects
+
+  /// Triangle test by separating axes: the box axes, the triangle normal
+  /// and the nine edge cross products.
+
+  bool Intersects(const Vector3& a, const Vector3& b, const Vector3& c) const{
+    const float v[3][3] = {
+      {a.x - Center.x, a.y - Center.y, a.z - Center.z},
+      {b.x - Center.x, b.y - Center.y, b.z - Center.z},
+      {c.x - Center.x, c.y - Center.y, c.z - Center.z}};
+    const float h[3] = {Extents.x, Extents.y, Extents.z};
+    float e[3][3];
+
+    for(int i=0; i<3; i++)
+      for(int k=0; k<3; k++)
+        e[i][k] = v[(i + 1)%3][k] - v[i][k];
+
+    auto separated = [&](const float ax[3]){
+      float lo = FLT_MAX, hi = -FLT_MAX;
+      for(int i=0; i<3; i++){
+        const float p = v[i][0]*ax[0] + v[i][1]*ax[1] + v[i][2]*ax[2];
+        lo = std::min(lo, p); hi = std::max(hi, p);
+      } //for
+      const float r = h[0]*fabsf(ax[0]) + h[1]*fabsf(ax[1]) + h[2]*fabsf(ax[2]);
+      return lo > r || hi < -r;
+    }; //separated
+
+    for(int k=0; k<3; k++){ //box axes
+      const float ax[3] = {k == 0? 1.0f: 0.0f, k == 1? 1.0f: 0.0f, k == 2? 1.0f: 0.0f};
+      if(separated(ax))return false;
+    } //for
+
+    const float n[3] = { //triangle normal
+      e[0][1]*e[1][2] - e[0][2]*e[1][1],
+      e[0][2]*e[1][0] - e[0][0]*e[1][2],
+      e[0][0]*e[1][1] - e[0][1]*e[1][0]};
+    if(separated(n))return false;
+
+    for(int k=0; k<3; k++) //edge cross products
+      for(int i=0; i<3; i++){
+        const float u[3] = {k == 0? 1.0f: 0.0f, k == 1? 1.0f: 0.0f, k == 2? 1.0f: 0.0f};
+        const float ax[3] = {
+          u[1]*e[i][2] - u[2]*e[i][1],
+          u[2]*e[i][0] - u[0]*e[i][2],
+          u[0]*e[i][1] - u[1]*e[i][0]};
+        if(separated(ax))return false;
+      } //for
+
+    return true;
+  } //Intersects
+}; //BoundingBox
+
+/// \brief Bounding sphere.
+
+struct BoundingSphere{
+  Vector3 Center;
+  float Radius = 1.0f;
+
+  BoundingSphere(){}
+  BoundingSphere(const Vector3& c, float r): Center(c), Radius(r){}
+
+  bool Intersects(const BoundingBox& b) const{
+    float d = 0.0f;
+    const float c[3] = {Center.x - b.Center.x, Center.y - b.Center.y, Center.z - b.Center.z};
+    const float h[3] = {b.Extents.x, b.Extents.y, b.Extents.z};
+    for(int k=0; k<3; k++){
+      const float a = std::max(0.0f, fabsf(c[k]) - h[k]);
+      d += a*a;
+    } //for
+    return d <= Radius*Radius;
+  } //Intersects
+
+  int Contains(const Vector3& p) const{
+    const float dx = p.x - Center.x, dy = p.y - Center.y, dz = p.z - Center.z;
+    return dx*dx + dy*dy + dz*dz <= Radius*Radius? 2: 0;
+  } //Contains
+}; //BoundingSphere
+
+#define fopen_s(pf, name, mode) (*(pf) = fopen((name), (mode)))
+
+#endif //__L4RC_BENCH_DEFINES_H__
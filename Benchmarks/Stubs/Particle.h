@@ -0,0 +1,21 @@
+/// \file Particle.h
+/// \brief Stand-in for the engine's particle descriptor, for the benchmarks.
+
+#ifndef __L4RC_BENCH_PARTICLE_H__
+#define __L4RC_BENCH_PARTICLE_H__
+
+#include "Sprite.h"
+
+/// \brief Particle descriptor.
+
+struct LParticleDesc2D: LSpriteDesc2D{
+  Vector2 m_vVel;
+  float m_fLifeSpan = 1.0f;
+  float m_fMaxScale = 1.0f;
+  float m_fScaleInFrac = 0.0f;
+  float m_fScaleOutFrac = 0.0f;
+  float m_fFadeInFrac = 0.0f;
+  float m_fFadeOutFrac = 0.0f;
+}; //LParticleDesc2D
+
+#endif //__L4RC_BENCH_PARTICLE_H__
@@ -0,0 +1,15 @@
+/// \file Settings.h
+/// \brief Stand-in for the engine's settings, for the benchmarks.
+
+#ifndef __L4RC_BENCH_SETTINGS_H__
+#define __L4RC_BENCH_SETTINGS_H__
+
+/// \brief Window settings, fixed at the size in `gamesettings.xml`.
+
+class LSettings{
+  protected:
+    static int m_nWinWidth; ///< Window width in pixels.
+    static int m_nWinHeight; ///< Window height in pixels.
+}; //LSettings
+
+#endif //__L4RC_BENCH_SETTINGS_H__
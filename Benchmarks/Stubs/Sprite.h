@@ -0,0 +1,25 @@
+/// \file Sprite.h
+/// \brief Stand-in for the engine's sprite descriptor, for the benchmarks.
+
+#ifndef __L4RC_BENCH_SPRITE_H__
+#define __L4RC_BENCH_SPRITE_H__
+
+#include "Defines.h"
+
+/// \brief Sprite descriptor.
+
+struct LSpriteDesc2D{
+  UINT m_nSpriteIndex = 0;
+  UINT m_nCurrentFrame = 0;
+  Vector2 m_vPos;
+  float m_fRoll = 0.0f;
+  float m_fXScale = 1.0f;
+  float m_fYScale = 1.0f;
+  float m_fAlpha = 1.0f;
+  XMFLOAT4 m_f4Tint = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f);
+
+  LSpriteDesc2D(){}
+  LSpriteDesc2D(UINT n, const Vector2& v): m_nSpriteIndex(n), m_vPos(v){}
+}; //LSpriteDesc2D
+
+#endif //__L4RC_BENCH_SPRITE_H__
@@ -0,0 +1,31 @@
+/// \file SpriteRenderer.h
+/// \brief Stand-in for the engine's sprite renderer, for the benchmarks.
+
+#ifndef __L4RC_BENCH_SPRITERENDERER_H__
+#define __L4RC_BENCH_SPRITERENDERER_H__
+
+#include "Sprite.h"
+
+/// \brief Sprite renderer that counts what it is asked to draw. Every
+/// sprite is one 32-pixel tile in size with one frame.
+
+class LSpriteRenderer{
+  private:
+    Vector3 m_vCameraPos; ///< Camera position.
+    size_t m_nDrawn = 0; ///< Number of sprites drawn.
+
+  public:
+    void Draw(const LSpriteDesc2D*){m_nDrawn++;}
+    template<class T> void DrawBoundingBox(T, const BoundingBox&){}
+
+    void SetCameraPos(const Vector3& v){m_vCameraPos = v;}
+    Vector3 GetCameraPos() const{return m_vCameraPos;}
+
+    template<class T> float GetWidth(T) const{return 32.0f;}
+    template<class T> float GetHeight(T) const{return 32.0f;}
+    template<class T> UINT GetNumFrames(T) const{return 1;}
+
+    size_t GetNumDrawn() const{return m_nDrawn;}
+}; //LSpriteRenderer
+
+#endif //__L4RC_BENCH_SPRITERENDERER_H__
@@ -0,0 +1,22 @@
+/// \file Stubs.cpp
+/// \brief Static members of the stand-ins for the engine, for the benchmarks.
+
+#include "Defines.h"
+#include "Component.h"
+#include "Settings.h"
+
+const Vector2 Vector2::Zero(0.0f, 0.0f);
+const Vector2 Vector2::One(1.0f, 1.0f);
+const Vector2 Vector2::UnitX(1.0f, 0.0f);
+const Vector2 Vector2::UnitY(0.0f, 1.0f);
+const Vector3 Vector3::Zero(0.0f, 0.0f, 0.0f);
+const Vector3 Vector3::One(1.0f, 1.0f, 1.0f);
+
+static LTimer g_cTimer; ///< The timer.
+static LRandom g_cRandom; ///< The random number generator.
+
+LTimer* LComponent::m_pTimer = &g_cTimer;
+LRandom* LComponent::m_pRandom = &g_cRandom;
+
+int LSettings::m_nWinWidth = 1024;
+int LSettings::m_nWinHeight = 768;
@@ -0,0 +1,216 @@
+/// \file TileSpriteBench.cpp
+/// \brief Equivalence test and benchmark for the tile sprite tables.
+///
+/// Loads every shipped map and moves the camera to the center of each tile
+/// in turn. For each position, looks up the ground and flavor sprites of
+/// every tile in the visible window, as `CTileManager::GetVisibleTiles()`
+/// finds it. The lookups are done with `CTileManager::GetGroundSprite` and
+/// `CTileManager::GetFlavorSprite`, and again with the original lookup,
+/// which searched a `std::map` keyed on `c*c + n` and called `at()` once per
+/// field it copied. Reports the number of lookups, how many found a sprite
+/// and how long each took, and checks that both versions find the same
+/// sprites.
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "SpriteRenderer.h"
+
+#define private public //reach the tables and the map for the reference
+#include "TileManager.h"
+#undef private
+
+/// \brief Gives the benchmark access to the renderer pointer that the game
+/// sets up in `CGame::Initialize()`.
+
+class CBench: public CCommon{
+  public:
+    /// Writer function for the renderer.
+    /// \param p Pointer to a renderer.
+
+    static void SetRenderer(LSpriteRenderer* p){
+      m_pRenderer = p;
+    } //SetRenderer
+}; //CBench
+
+typedef std::map<UINT, LSpriteDesc2D> SpriteMap; ///< The original sprite map.
+
+/// Fill a sprite map the way the original `InitializeGroundMap()` and
+/// `InitializeFlavorValMap()` did, with the same sprites as a table.
+/// \param table Ground or flavor table.
+/// \param m [out] Sprite map.
+
+static void MakeMap(const CTileSpriteTable& table, SpriteMap& m){
+  for(UINT c=0; c<256; c++)
+    for(UINT n=0; n<NUM_MASK_FRAMES; n++){
+      const STileSprite& e = table[c][n];
+
+      if(e.m_bValid){
+        LSpriteDesc2D desc;
+        desc.m_nSpriteIndex = e.m_nSpriteIndex;
+        desc.m_nCurrentFrame = e.m_nCurrentFrame;
+        desc.m_vPos = e.m_vOffset;
+        desc.m_fXScale = e.m_fXScale;
+        desc.m_fYScale = e.m_fYScale;
+        desc.m_fRoll = e.m_fRoll;
+        m.insert(std::pair<UINT, LSpriteDesc2D>(UINT(c*c) + n, desc));
+      } //if
+    } //for
+} //MakeMap
+
+/// The original sprite lookup.
+/// \param m Sprite map.
+/// \param desc Sprite descriptor with the tile position already set.
+/// \param c Map char.
+/// \param mc Mask char.
+/// \return 0 on success. -1 on no match.
+
+static int Reference(const SpriteMap& m, LSpriteDesc2D* desc, const char c, const char mc){
+  UINT n = mc - (UINT)49; //convert ascii char to int
+  auto it = m.find((UINT((UINT)c * (UINT)c) + n)); //check for matching sprite in map
+  if(it != m.end()){ //match found
+    desc->m_nSpriteIndex = m.at((UINT((UINT)c * (UINT)c) + n)).m_nSpriteIndex;
+    desc->m_vPos += m.at((UINT((UINT)c * (UINT)c) + n)).m_vPos; //add offset, don't copy
+    desc->m_nCurrentFrame = m.at((UINT((UINT)c * (UINT)c) + n)).m_nCurrentFrame;
+    desc->m_fXScale = m.at((UINT((UINT)c * (UINT)c) + n)).m_fXScale;
+    desc->m_fYScale = m.at((UINT((UINT)c * (UINT)c) + n)).m_fYScale;
+    desc->m_fRoll = m.at((UINT((UINT)c * (UINT)c) + n)).m_fRoll;
+    return 0;
+  } //if
+  else return -1; //match not found
+} //Reference
+
+/// \brief Totals over the lookups in a pass.
+
+struct STotals{
+  size_t m_nLookups = 0; ///< Number of lookups.
+  size_t m_nHits = 0; ///< Number of lookups that found a sprite.
+  double m_fSum = 0.0; ///< Checksum of the sprites found.
+
+  /// Add a lookup to the totals.
+  /// \param r Return value of the lookup.
+  /// \param d Sprite descriptor that it set.
+
+  void Add(int r, const LSpriteDesc2D& d){
+    m_nLookups++;
+
+    if(r == 0){
+      m_nHits++;
+      m_fSum += d.m_nSpriteIndex + 16.0*d.m_nCurrentFrame + d.m_vPos.x + 2.0*d.m_vPos.y +
+        d.m_fXScale + 3.0*d.m_fYScale + d.m_fRoll;
+    } //if
+  } //Add
+}; //STotals
+
+/// Look up the ground and flavor sprites of every tile in the visible window
+/// at each camera position.
+/// \param tm Tile manager.
+/// \param renderer Renderer, whose camera is moved.
+/// \param f Function that does a lookup, taking a flag that is true for
+/// flavor, the descriptor, the char and the mask char.
+/// \return Totals.
+
+template<class F> static STotals Pass(CTileManager& tm, LSpriteRenderer& renderer, F f){
+  STotals s;
+  const float t = tm.GetTileSize();
+
+  for(size_t ci=0; ci<tm.m_nHeight; ci++)
+    for(size_t cj=0; cj<tm.m_nWidth; cj++){
+      renderer.SetCameraPos(Vector3(t*(cj + 0.5f), t*(ci + 0.5f), 0.0f));
+
+      int top, bottom, left, right; //visible tiles
+      tm.GetVisibleTiles(top, bottom, left, right);
+
+      for(int i=top; i<=bottom; i++)
+        for(int j=left; j<=right; j++){
+          const STile& tile = tm.At(i, j);
+          LSpriteDesc2D desc;
+          desc.m_vPos = t*Vector2((float)j, (float)(tm.m_nHeight - 1 - i));
+
+          if(tile.m_chGroundMask != '0')
+            s.Add(f(false, desc, tile.m_chGround, tile.m_chGroundMask), desc);
+
+          if(tile.m_chFlavorMask != '0')
+            s.Add(f(true, desc, tile.m_chFlavor, tile.m_chFlavorMask), desc);
+        } //for
+    } //for
+
+  return s;
+} //Pass
+
+/// Whether a file exists.
+/// \param name File name.
+/// \return true if it can be opened.
+
+static bool Exists(const std::string& name){
+  FILE* f = fopen(name.c_str(), "rb");
+  if(f)fclose(f);
+  return f != nullptr;
+} //Exists
+
+int main(int argc, char* argv[]){
+  const std::string dir = argc > 1? argv[1]: "../Media/Maps/"; //map folder
+
+  const char* maps[] = {
+    "level_01", "levelmaze", "lastlevel", "boss", "level_02", "level_03", "level_04", "test",
+    "TestMaps/map", "TestMaps/small", "TestMaps/test", "TestMaps/test2", "TestMaps/tiny"
+  }; //maps
+
+  LSpriteRenderer renderer;
+  CBench::SetRenderer(&renderer);
+
+  size_t failures = 0; //maps on which the lookups differ
+  double totalOld = 0, totalNew = 0; //total times
+
+  printf("%-15s %7s %10s %9s %10s %10s %7s\n",
+    "map", "size", "lookups", "hits", "map ms", "table ms", "differ");
+
+  for(const char* name: maps){
+    std::string ground = dir + name + ".txt";
+    std::string mapmask = dir + name + "MapMask.txt";
+    std::string flavor = dir + name + "Flavor.txt";
+    std::string mask = dir + name + "FlavorMask.txt";
+
+    if(!Exists(mapmask) || !Exists(flavor) || !Exists(mask)) //no hand-made masks
+      mapmask = flavor = mask = ground;
+
+    CTileManager tm(32);
+    std::vector<char> a(ground.begin(), ground.end()), b(mapmask.begin(), mapmask.end()),
+      c(flavor.begin(), flavor.end()), d(mask.begin(), mask.end());
+    a.push_back(0); b.push_back(0); c.push_back(0); d.push_back(0);
+    tm.LoadMap(a.data(), b.data(), c.data(), d.data(), 0);
+
+    SpriteMap groundMap, flavorMap;
+    MakeMap(tm.m_sGroundTable, groundMap);
+    MakeMap(tm.m_sFlavorTable, flavorMap);
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    const STotals sOld = Pass(tm, renderer, [&](bool bFlavor, LSpriteDesc2D& desc, char ch, char m){
+      return Reference(bFlavor? flavorMap: groundMap, &desc, ch, m);
+    }); //Pass
+    auto t1 = std::chrono::high_resolution_clock::now();
+    const STotals sNew = Pass(tm, renderer, [&](bool bFlavor, LSpriteDesc2D& desc, char ch, char m){
+      return bFlavor? tm.GetFlavorSprite(&desc, ch, m): tm.GetGroundSprite(&desc, ch, m);
+    }); //Pass
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    const double msOld = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    const double msNew = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    const bool bDiffer = sOld.m_nLookups != sNew.m_nLookups ||
+      sOld.m_nHits != sNew.m_nHits || sOld.m_fSum != sNew.m_fSum;
+
+    printf("%-15s %3zux%-3zu %10zu %9zu %10.1f %10.1f %7s\n", name, tm.m_nWidth, tm.m_nHeight,
+      sNew.m_nLookups, sNew.m_nHits, msOld, msNew, bDiffer? "yes": "no");
+
+    if(bDiffer)failures++;
+    totalOld += msOld;
+    totalNew += msNew;
+  } //for
+
+  printf("all maps: %.1f ms for the map, %.1f ms for the table, %zu maps differ\n",
+    totalOld, totalNew, failures);
+
+  return failures == 0? 0: 1;
+} //main
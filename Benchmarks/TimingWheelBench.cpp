@@ -0,0 +1,215 @@
+/// \file TimingWheelBench.cpp
+/// \brief Benchmark and checks for `CTimingWheel`.
+///
+/// Schedules 100k particle events over 100 seconds of 60 fps frames, with
+/// delays of up to 5 seconds, and fires them with the timing wheel, the way
+/// `CGame::FireTimedEvents()` does, and with a `std::priority_queue` popped
+/// one event at a time, the way the game did before the wheel. Then
+/// schedules 200k events in a randomized run, with frame times from zero to
+/// a tenth of a second and delays from zero to longer than the third wheel
+/// covers, and checks that every event goes off exactly once, never before
+/// its delay is up, and on the first frame that reaches the tick it is due.
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "TimingWheel.h"
+
+/// \brief A particle event on the old heap.
+
+struct SOldEvent{
+  float m_fTime = 0.0f; ///< Time when the particle should be created.
+  LParticleDesc2D m_cDesc; ///< Particle to create.
+
+  /// Order events by time, for a min-heap.
+  /// \param e Another event.
+  /// \return true if this event is due after the other one.
+
+  bool operator>(const SOldEvent& e) const{
+    return m_fTime > e.m_fTime;
+  } //operator>
+}; //SOldEvent
+
+typedef std::priority_queue<SOldEvent, std::vector<SOldEvent>, std::greater<SOldEvent>> OldQueue; ///< The old heap.
+
+/// Time the old heap and the timing wheel on the same events.
+/// \return true if they fire the same number of events.
+
+static bool Bench(){
+  const size_t N = 100000; //number of events
+  const size_t FRAMES = 6000; //frames over which they are scheduled
+  const float dt = 1.0f/60.0f; //frame time
+
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> delay(0.0f, 5.0f);
+  std::vector<float> vDelay(N); //delays
+
+  for(float& d: vDelay)
+    d = delay(gen);
+
+  using clock = std::chrono::high_resolution_clock;
+  double sumOld = 0, sumNew = 0; //checksums, so the work can't be skipped
+  size_t nOld = 0, nNew = 0; //number of events fired
+
+  //old: a priority queue, keyed by time, popped one at a time
+
+  auto t0 = clock::now();
+  {
+    OldQueue q;
+    float t = 0.0f; //current time
+    size_t next = 0; //next event to schedule
+
+    for(size_t f=0; next < N || !q.empty(); f++){
+      t += dt;
+
+      for(; next < N && next < (f + 1)*N/FRAMES; next++){
+        SOldEvent e;
+        e.m_fTime = t + vDelay[next];
+        e.m_cDesc.m_vPos = Vector2((float)next, 0.0f);
+        q.push(e);
+      } //for
+
+      while(!q.empty() && t >= q.top().m_fTime){
+        sumOld += q.top().m_cDesc.m_vPos.x;
+        nOld++;
+        q.pop();
+      } //while
+    } //for
+  }
+  auto t1 = clock::now();
+
+  //new: the timing wheel, collecting a batch per frame
+
+  {
+    CTimingWheel w;
+    std::vector<STimedEvent> batch;
+    size_t next = 0; //next event to schedule
+
+    for(size_t f=0; next < N || !w.empty(); f++){
+      for(; next < N && next < (f + 1)*N/FRAMES; next++){
+        LParticleDesc2D d;
+        d.m_vPos = Vector2((float)next, 0.0f);
+        w.Schedule(vDelay[next], d, eParticleCategory::Ambience);
+      } //for
+
+      w.Advance(dt, batch);
+
+      for(STimedEvent& e: batch){
+        sumNew += e.m_cParticle.m_cDesc.m_vPos.x;
+        nNew++;
+      } //for
+
+      batch.clear();
+    } //for
+  }
+  auto t2 = clock::now();
+
+  printf("%zu events over %zu frames, delays up to 5s\n", N, FRAMES);
+  printf("  std::priority_queue  %.3f ms, %zu fired\n",
+    std::chrono::duration<double, std::milli>(t1 - t0).count(), nOld);
+  printf("  CTimingWheel         %.3f ms, %zu fired\n",
+    std::chrono::duration<double, std::milli>(t2 - t1).count(), nNew);
+
+  return nOld == N && nNew == N && sumOld == sumNew;
+} //Bench
+
+/// Schedule events at random, advance by random frame times, and check
+/// that each event goes off exactly once, on the first frame that reaches
+/// its tick, and no sooner than its delay.
+/// \return true if every event went off on time.
+
+static bool Check(){
+  const size_t N = 200000; //number of events
+  const size_t FRAMES = 20000; //frames over which they are scheduled
+  const UINT64 NONE = 0xFFFFFFFFFFFFFFFF; //not fired
+
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+  CTimingWheel w;
+  std::vector<STimedEvent> batch;
+
+  std::vector<float> vDelay(N); //delays
+  std::vector<UINT64> vStart(N); //ticks when scheduled
+  std::vector<UINT64> vFired(N, NONE); //ticks when fired
+  std::vector<UINT64> vBefore(N, NONE); //ticks before the frames when fired
+  std::vector<size_t> vCount(N, 0); //number of times fired
+  UINT64 before = 0; //tick before the current frame
+
+  size_t next = 0; //next event to schedule
+  size_t nFrames = 0; //number of frames
+  size_t nWrong = 0; //events of the wrong type
+
+  for(size_t f=0; next < N || !w.empty(); f++, nFrames++){
+    for(; next < N && next < (f + 1)*N/FRAMES; next++){
+      const float r = unit(gen); //which kind of delay
+      float d = 0.0f; //delay
+
+      if(r < 0.05f)d = 0.0f; //due on the next tick
+      else if(r < 0.10f)d = CTimingWheel::TICK*(gen()%1000); //whole number of ticks
+      else if(r < 0.70f)d = 2.0f*unit(gen); //first wheel
+      else if(r < 0.95f)d = 150.0f*unit(gen); //second wheel
+      else if(r < 0.99f)d = 10000.0f*unit(gen); //third wheel
+      else d = 10000.0f + 2000.0f*unit(gen); //further than the third wheel covers
+
+      const size_t i = next; //event index
+      vDelay[i] = d;
+      vStart[i] = w.GetTick();
+
+      w.Schedule(d, [&, i](){
+        vFired[i] = w.GetTick();
+        vBefore[i] = before;
+        vCount[i]++;
+      }); //Schedule
+    } //for
+
+    const float r = unit(gen); //which kind of frame
+    const float dt = r < 0.1f? 0.0f: r < 0.2f? CTimingWheel::TICK: 0.1f*unit(gen); //frame time
+
+    before = w.GetTick();
+    w.Advance(dt, batch);
+
+    for(STimedEvent& e: batch){
+      if(e.m_eType == eTimedEvent::Callback)
+        e.m_fnCallback();
+
+      else nWrong++;
+    } //for
+
+    batch.clear();
+  } //for
+
+  //an event is due on the first tick at or after its delay is up, and
+  //at least one tick after it was scheduled. It is early if it goes off
+  //on a frame that ends before that tick, and late if it goes off on a
+  //frame that starts on or after it
+
+  size_t nMissed = 0, nRepeat = 0, nEarly = 0, nLate = 0; //failures
+
+  for(size_t i=0; i<N; i++){
+    if(vCount[i] == 0){nMissed++; continue;}
+    if(vCount[i] > 1){nRepeat++; continue;}
+
+    UINT64 n = (UINT64)ceil((double)vDelay[i]/CTimingWheel::TICK); //ticks to wait
+    n = std::max<UINT64>(n, 1);
+
+    if(vFired[i] < vStart[i] + n)nEarly++;
+    if(vBefore[i] >= vStart[i] + n)nLate++;
+  } //for
+
+  printf("%zu random events over %zu frames and %.0fs\n", N, nFrames, w.GetTick()*CTimingWheel::TICK);
+  printf("  %zu missed, %zu fired more than once, %zu early, %zu late, %zu of the wrong type\n",
+    nMissed, nRepeat, nEarly, nLate, nWrong);
+
+  return nMissed == 0 && nRepeat == 0 && nEarly == 0 && nLate == 0 && nWrong == 0 && w.empty();
+} //Check
+
+int main(){
+  const bool bBench = Bench();
+  const bool bCheck = Check();
+  return bBench && bCheck? 0: 1;
+} //main
@@ -0,0 +1,155 @@
+/// \file VisibleTest.cpp
+/// \brief Equivalence test and benchmark for `CTileManager::Visible`.
+///
+/// Loads every shipped map and asks the same random visibility queries of
+/// `CTileManager::Visible` and of the original version, which intersected
+/// two triangles with every wall, and reports any queries on which they
+/// disagree and how long each took. Observers stand on floor tiles, targets
+/// are up to 12 tiles away in any direction, and radii are between 4 and
+/// 32 pixels, which covers the player as seen by the enemies that call it.
+
+#include <vector>
+#include <random>
+#include <utility>
+#include <queue>
+#include <functional>
+#include <string>
+#include <chrono>
+
+#define private public //reach the wall list for the reference test
+#include "TileManager.h"
+#undef private
+
+/// The original visibility test, which intersects the triangles to each side
+/// of the circle with every wall.
+/// \param tm Tile manager.
+/// \param p0 A point.
+/// \param p1 Center of circle.
+/// \param r Radius of circle.
+/// \return true If the circle is visible from the point.
+
+static bool Reference(const CTileManager& tm, const Vector2& p0, const Vector2& p1, float r){
+  bool visible = true;
+
+  for(auto i=tm.m_vecWalls.begin(); i!=tm.m_vecWalls.end() && visible; i++){
+    Vector2 direction = p0 - p1;
+    direction.Normalize();
+    const Vector2 norm = Vector2(-direction.y, direction.x);
+
+    const float delta = std::min(r, 16.0f);
+
+    //left-hand triangle
+    const Vector3 v0(p0);
+    const Vector3 v1(p1 + r*norm);
+    const Vector3 v2(p1 + (r - delta)*norm);
+
+    //right-hand triangle
+    const Vector3 v3(p1 - r*norm);
+    const Vector3 v4(p1 - (r - delta)*norm);
+
+    visible = !(*i).Intersects(v0, v1, v2) || !(*i).Intersects(v0, v3, v4);
+  } //for
+
+  return visible;
+} //Reference
+
+/// \brief A visibility query.
+
+struct SQuery{
+  Vector2 m_vFrom; ///< Observer.
+  Vector2 m_vTo; ///< Center of circle.
+  float m_fRadius; ///< Radius of circle.
+}; //SQuery
+
+/// Whether a file exists.
+/// \param name File name.
+/// \return true if it can be opened.
+
+static bool Exists(const std::string& name){
+  FILE* f = fopen(name.c_str(), "rb");
+  if(f)fclose(f);
+  return f != nullptr;
+} //Exists
+
+int main(int argc, char* argv[]){
+  const std::string dir = argc > 1? argv[1]: "../Media/Maps/"; //map folder
+
+  const char* maps[] = {
+    "level_01", "levelmaze", "lastlevel", "boss", "level_02", "level_03", "level_04", "test",
+    "TestMaps/map", "TestMaps/small", "TestMaps/test", "TestMaps/test2", "TestMaps/tiny"
+  }; //maps
+
+  const size_t QUERIES = 200000; //queries per map
+  size_t total = 0, failures = 0; //over all maps
+
+  printf("%-15s %7s %6s %9s %9s %10s %10s %8s\n",
+    "map", "size", "walls", "queries", "visible", "old ms", "new ms", "differ");
+
+  for(const char* name: maps){
+    std::string ground = dir + name + ".txt";
+    std::string mapmask = dir + name + "MapMask.txt";
+    std::string flavor = dir + name + "Flavor.txt";
+    std::string mask = dir + name + "FlavorMask.txt";
+
+    if(!Exists(mapmask) || !Exists(flavor) || !Exists(mask)) //walls only depend on the ground map
+      mapmask = flavor = mask = ground;
+
+    CTileManager tm(32);
+    std::vector<char> a(ground.begin(), ground.end()), b(mapmask.begin(), mapmask.end()),
+      c(flavor.begin(), flavor.end()), d(mask.begin(), mask.end());
+    a.push_back(0); b.push_back(0); c.push_back(0); d.push_back(0);
+    tm.LoadMap(a.data(), b.data(), c.data(), d.data(), 0);
+
+    const float t = tm.GetTileSize();
+    std::vector<Vector2> floor; //floor tile corners
+
+    for(size_t i=0; i<tm.m_nHeight; i++)
+      for(size_t j=0; j<tm.m_nWidth; j++)
+        if(!(tm.At(i, j).m_nFlags & STile::SOLID))
+          floor.push_back(t*Vector2((float)j, (float)(tm.m_nHeight - 1 - i)));
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<SQuery> q(QUERIES);
+
+    for(SQuery& s: q){
+      s.m_vFrom = floor[gen()%floor.size()] + t*Vector2(unit(gen), unit(gen));
+      const float theta = XM_2PI*unit(gen);
+      s.m_vTo = s.m_vFrom + 12.0f*t*unit(gen)*Vector2(cosf(theta), sinf(theta));
+      s.m_fRadius = 4.0f + 28.0f*unit(gen);
+    } //for
+
+    std::vector<char> old(q.size()), now(q.size()); //results
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(size_t k=0; k<q.size(); k++)
+      old[k] = Reference(tm, q[k].m_vFrom, q[k].m_vTo, q[k].m_fRadius);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for(size_t k=0; k<q.size(); k++)
+      now[k] = tm.Visible(q[k].m_vFrom, q[k].m_vTo, q[k].m_fRadius);
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    size_t differ = 0, visible = 0;
+
+    for(size_t k=0; k<q.size(); k++){
+      visible += old[k];
+
+      if(old[k] != now[k]){
+        if(differ++ < 5)
+          printf("  %s: from (%.2f, %.2f) to (%.2f, %.2f) r %.2f: old %d new %d\n", name,
+            q[k].m_vFrom.x, q[k].m_vFrom.y, q[k].m_vTo.x, q[k].m_vTo.y, q[k].m_fRadius, old[k], now[k]);
+      } //if
+    } //for
+
+    printf("%-15s %3zux%-3zu %6zu %9zu %9zu %10.1f %10.1f %8zu\n", name, tm.m_nWidth, tm.m_nHeight,
+      tm.m_vecWalls.size(), q.size(), visible,
+      std::chrono::duration<double, std::milli>(t1 - t0).count(),
+      std::chrono::duration<double, std::milli>(t2 - t1).count(), differ);
+
+    total += q.size();
+    failures += differ;
+  } //for
+
+  printf("%zu of %zu queries differ\n", failures, total);
+  return failures == 0? 0: 1;
+} //main
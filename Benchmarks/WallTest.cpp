@@ -0,0 +1,231 @@
+/// \file WallTest.cpp
+/// \brief Equivalence test and benchmark for `CTileManager::CollideWithWall`.
+///
+/// Loads every shipped map and pushes the same random spheres out of the
+/// walls the way `CObjectManager::BroadPhase()` does, in two passes that ask
+/// again after each response, once with `CTileManager::CollideWithWall` and
+/// once with the original version, which tested every wall in order and
+/// stopped at the first hit. Reports any spheres that end up in different
+/// places or with different responses and how long each took. Centers are on
+/// floor tiles, tiles are 64 pixels, and radii are between 8 and 32 pixels.
+/// Spheres that touch no wall are not counted.
+
+#include <vector>
+#include <random>
+#include <utility>
+#include <queue>
+#include <functional>
+#include <string>
+#include <chrono>
+
+#define private public //reach the wall list for the reference test
+#include "TileManager.h"
+#undef private
+
+/// The original object-wall collision test, which tests every wall in order
+/// and stops at the first hit.
+/// \param tm Tile manager.
+/// \param s Bounding sphere of object.
+/// \param norm [out] Collision normal.
+/// \param d [out] Overlap distance.
+/// \return true if the bounding sphere overlaps a wall.
+
+static bool Reference(const CTileManager& tm, BoundingSphere s, Vector2& norm, float& d){
+  bool hit = false;
+
+  for(auto i=tm.m_vecWalls.begin(); i!=tm.m_vecWalls.end() && !hit; i++){
+    const BoundingBox& aabb = *i;
+
+    Vector3 corner[8];
+    aabb.GetCorners(corner);
+    s.Center.z = corner[0].z;
+
+    hit = s.Intersects(aabb);
+
+    if(hit){
+      bool bPointCollide = false;
+
+      for(UINT i=0; i<4 && !bPointCollide; i++)
+        if(s.Contains(corner[i])){
+          bPointCollide = true;
+          Vector3 norm3 = s.Center - corner[i];
+          norm = (Vector2)norm3;
+          d = s.Radius - norm.Length();
+          norm.Normalize();
+        } //if
+
+      if(!bPointCollide){
+        const float fLeft   = corner[0].x;
+        const float fRight  = corner[1].x;
+        const float fBottom = corner[1].y;
+        const float fTop    = corner[2].y;
+
+        const float epsilon = 0.01f;
+
+        if(s.Center.x <= fLeft){
+          norm = -Vector2::UnitX;
+          d = s.Center.x - fLeft + s.Radius + epsilon;
+        } //if
+
+        else if(fRight <= s.Center.x){
+          norm = Vector2::UnitX;
+          d = fRight - s.Center.x + s.Radius + epsilon;
+        } //if
+
+        else if(s.Center.y <= fBottom){
+          norm = -Vector2::UnitY;
+          d = s.Center.y - fBottom + s.Radius + epsilon;
+        } //if
+
+        else if(fTop <= s.Center.y){
+          norm = Vector2::UnitY;
+          d = fTop - s.Center.y + s.Radius + epsilon;
+        } //if
+      } //if
+    } //if
+  } //for
+
+  return hit;
+} //Reference
+
+/// \brief The outcome of pushing a sphere out of the walls.
+
+struct SOutcome{
+  Vector2 m_vPos; ///< Final position.
+  int m_nHits = 0; ///< Number of responses.
+
+  /// Compare outcomes exactly.
+  /// \param o Another outcome.
+  /// \return true if they are the same.
+
+  bool operator==(const SOutcome& o) const{
+    return m_vPos.x == o.m_vPos.x && m_vPos.y == o.m_vPos.y && m_nHits == o.m_nHits;
+  } //operator==
+}; //SOutcome
+
+/// Push a sphere out of the walls the way `CObjectManager::BroadPhase()`
+/// does, responding like a moving object that hits a static one.
+/// \param f Collision test.
+/// \param pos Center of sphere.
+/// \param r Radius of sphere.
+/// \return Where the sphere ends up and how many responses there were.
+
+template<class F> static SOutcome Push(F f, const Vector2& pos, float r){
+  SOutcome o;
+  o.m_vPos = pos;
+
+  for(int i=0; i<2; i++){
+    Vector2 norm;
+    float d = 0;
+    BoundingSphere s(Vector3(o.m_vPos), r);
+
+    if(f(s, norm, d)){
+      o.m_vPos += d*norm;
+      o.m_nHits++;
+    } //if
+  } //for
+
+  return o;
+} //Push
+
+/// Whether a file exists.
+/// \param name File name.
+/// \return true if it can be opened.
+
+static bool Exists(const std::string& name){
+  FILE* f = fopen(name.c_str(), "rb");
+  if(f)fclose(f);
+  return f != nullptr;
+} //Exists
+
+int main(int argc, char* argv[]){
+  const std::string dir = argc > 1? argv[1]: "../Media/Maps/"; //map folder
+
+  const char* maps[] = {
+    "level_01", "levelmaze", "lastlevel", "boss", "level_02", "level_03", "level_04", "test",
+    "TestMaps/map", "TestMaps/small", "TestMaps/test", "TestMaps/test2", "TestMaps/tiny"
+  }; //maps
+
+  const size_t SPHERES = 100000; //spheres per map
+  size_t total = 0, failures = 0; //over all maps
+
+  printf("%-15s %7s %6s %9s %9s %10s %10s %8s\n",
+    "map", "size", "walls", "spheres", "touching", "old ms", "new ms", "differ");
+
+  for(const char* name: maps){
+    std::string ground = dir + name + ".txt";
+    std::string mapmask = dir + name + "MapMask.txt";
+    std::string flavor = dir + name + "Flavor.txt";
+    std::string mask = dir + name + "FlavorMask.txt";
+
+    if(!Exists(mapmask) || !Exists(flavor) || !Exists(mask)) //walls only depend on the ground map
+      mapmask = flavor = mask = ground;
+
+    CTileManager tm(64);
+    std::vector<char> a(ground.begin(), ground.end()), b(mapmask.begin(), mapmask.end()),
+      c(flavor.begin(), flavor.end()), d(mask.begin(), mask.end());
+    a.push_back(0); b.push_back(0); c.push_back(0); d.push_back(0);
+    tm.LoadMap(a.data(), b.data(), c.data(), d.data(), 0);
+
+    const float t = tm.GetTileSize();
+    std::vector<Vector2> floor; //floor tile corners
+
+    for(size_t i=0; i<tm.m_nHeight; i++)
+      for(size_t j=0; j<tm.m_nWidth; j++)
+        if(!(tm.At(i, j).m_nFlags & STile::SOLID))
+          floor.push_back(t*Vector2((float)j, (float)(tm.m_nHeight - 1 - i)));
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<std::pair<Vector2, float>> q(SPHERES); //centers and radii
+
+    for(auto& s: q){
+      s.first = floor[gen()%floor.size()] + t*Vector2(unit(gen), unit(gen));
+      s.second = 8.0f + 24.0f*unit(gen);
+    } //for
+
+    std::vector<SOutcome> vOld(SPHERES), vNew(SPHERES);
+
+    auto reference = [&](BoundingSphere s, Vector2& norm, float& d){
+      return Reference(tm, s, norm, d);
+    }; //reference
+
+    auto indexed = [&](BoundingSphere s, Vector2& norm, float& d){
+      return tm.CollideWithWall(s, norm, d);
+    }; //indexed
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for(size_t i=0; i<SPHERES; i++)
+      vOld[i] = Push(reference, q[i].first, q[i].second);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for(size_t i=0; i<SPHERES; i++)
+      vNew[i] = Push(indexed, q[i].first, q[i].second);
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    size_t touching = 0, differ = 0;
+
+    for(size_t i=0; i<SPHERES; i++){
+      if(vOld[i].m_nHits > 0)touching++;
+
+      if(!(vOld[i] == vNew[i])){
+        if(differ++ < 3)
+          printf("  (%.1f, %.1f) r %.1f: old (%.2f, %.2f) %d hits, new (%.2f, %.2f) %d hits\n",
+            q[i].first.x, q[i].first.y, q[i].second,
+            vOld[i].m_vPos.x, vOld[i].m_vPos.y, vOld[i].m_nHits,
+            vNew[i].m_vPos.x, vNew[i].m_vPos.y, vNew[i].m_nHits);
+      } //if
+    } //for
+
+    const double msOld = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    const double msNew = std::chrono::duration<double, std::milli>(t2 - t1).count();
+
+    printf("%-15s %3zux%-3zu %6zu %9zu %9zu %10.1f %10.1f %8zu\n", name,
+      tm.m_nWidth, tm.m_nHeight, tm.m_vecWalls.size(), SPHERES, touching, msOld, msNew, differ);
+
+    total += touching;
+    failures += differ;
+  } //for
+
+  printf("%zu of %zu wall-touching spheres differ\n", failures, total);
+  return failures == 0? 0: 1;
+} //main
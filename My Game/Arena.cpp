@@ -0,0 +1,104 @@
+/// \file Arena.cpp
+/// \brief Code for the arena allocator CArena.
+
+#include <functional>
+#include <algorithm>
+
+#include "Arena.h"
+
+/// Destructor. Frees the blocks. Objects in them must already be destroyed.
+
+CArena::~CArena(){
+  for(SBlock& b: m_vecBlocks)
+    delete [] b.m_pData;
+} //destructor
+
+/// Allocate memory by bumping the offset into the current block past any
+/// padding needed for alignment. If the current block is full then move on
+/// to the next one, allocating a new block only if there are no more.
+/// Allocations larger than the default block size get a block of their own.
+/// \param n Number of bytes.
+/// \param align Alignment in bytes, a power of 2.
+/// \return Pointer to the memory.
+
+void* CArena::Alloc(size_t n, size_t align){
+  while(m_nBlock < m_vecBlocks.size()){ //existing blocks
+    const SBlock& b = m_vecBlocks[m_nBlock]; //current block
+    const size_t addr = (size_t)(b.m_pData + m_nOffset); //first free address
+    const size_t pad = (align - addr%align)%align; //padding for alignment
+
+    if(m_nOffset + pad + n <= b.m_nSize){ //fits
+      char* p = b.m_pData + m_nOffset + pad;
+      m_nOffset += pad + n;
+      m_nUsed += pad + n;
+      m_nHighWater = std::max<size_t>(m_nHighWater, m_nUsed);
+      return p;
+    } //if
+
+    m_nBlock++; //try the next block
+    m_nOffset = 0;
+  } //while
+
+  SBlock b; //new block, big enough for any alignment
+  b.m_nSize = std::max<size_t>(BLOCKSIZE, n + align);
+  b.m_pData = new char[b.m_nSize];
+  m_vecBlocks.push_back(b);
+
+  return Alloc(n, align); //fits this time
+} //Alloc
+
+/// Release everything allocated since the last reset by rewinding to the
+/// start of the first block. The blocks are kept for reuse.
+
+void CArena::Reset(){
+  m_nBlock = 0;
+  m_nOffset = 0;
+  m_nUsed = 0;
+} //Reset
+
+/// Determine whether memory came from this arena.
+/// \param p Pointer to memory.
+/// \return true if p is inside one of the arena's blocks.
+
+const bool CArena::Owns(const void* p) const{
+  const std::less<const void*> less; //pointer comparison
+
+  for(const SBlock& b: m_vecBlocks)
+    if(!less(p, b.m_pData) && less(p, b.m_pData + b.m_nSize))
+      return true;
+
+  return false;
+} //Owns
+
+/// Reader function for the bytes allocated since the last reset.
+/// \return Bytes used, including alignment padding.
+
+const size_t CArena::GetUsed() const{
+  return m_nUsed;
+} //GetUsed
+
+/// Reader function for the most bytes allocated between resets.
+/// \return High water mark in bytes.
+
+const size_t CArena::GetHighWater() const{
+  return m_nHighWater;
+} //GetHighWater
+
+/// Reader function for the total size of the blocks.
+/// \return Capacity in bytes.
+
+const size_t CArena::GetCapacity() const{
+  size_t n = 0;
+
+  for(const SBlock& b: m_vecBlocks)
+    n += b.m_nSize;
+
+  return n;
+} //GetCapacity
+
+/// Reader function for the number of blocks.
+/// \return Number of blocks allocated from the heap so far.
+
+const size_t CArena::GetNumBlocks() const{
+  return m_vecBlocks.size();
+} //GetNumBlocks
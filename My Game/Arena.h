@@ -0,0 +1,62 @@
+/// \file Arena.h
+/// \brief Interface for the arena allocator CArena.
+
+#ifndef __L4RC_GAME_ARENA_H__
+#define __L4RC_GAME_ARENA_H__
+
+#include <vector>
+#include <new>
+#include <utility>
+
+/// \brief A bump allocator for objects that live as long as a level.
+///
+/// Memory is handed out from large blocks by moving a pointer forward, with
+/// each allocation aligned for its type. Individual objects are never freed.
+/// Instead the owner destroys them in place and calls `Reset()` at the end of
+/// the level, which releases everything in one go. The blocks are kept for
+/// the next level, so after the first level no heap memory is allocated
+/// unless a level needs more than any level before it.
+
+class CArena{
+  private:
+    static const size_t BLOCKSIZE = 64*1024; ///< Default block size in bytes.
+
+    /// \brief A block of memory.
+
+    struct SBlock{
+      char* m_pData = nullptr; ///< Start of the block.
+      size_t m_nSize = 0; ///< Size of the block in bytes.
+    }; //SBlock
+
+    std::vector<SBlock> m_vecBlocks; ///< Blocks allocated so far.
+    size_t m_nBlock = 0; ///< Index of the block being allocated from.
+    size_t m_nOffset = 0; ///< Offset of the first free byte in the current block.
+
+    size_t m_nUsed = 0; ///< Bytes allocated since the last reset.
+    size_t m_nHighWater = 0; ///< Most bytes allocated between resets.
+
+    void* Alloc(size_t, size_t); ///< Allocate aligned memory.
+
+  public:
+    ~CArena(); ///< Destructor.
+
+    template<class T, class... Args> T* Create(Args&&...); ///< Construct an object.
+    void Reset(); ///< Release everything.
+    const bool Owns(const void*) const; ///< Whether memory came from this arena.
+
+    const size_t GetUsed() const; ///< Get bytes allocated since the last reset.
+    const size_t GetHighWater() const; ///< Get most bytes allocated between resets.
+    const size_t GetCapacity() const; ///< Get total size of the blocks.
+    const size_t GetNumBlocks() const; ///< Get number of blocks.
+}; //CArena
+
+/// Construct an object in memory from the arena. The object's destructor
+/// must be called explicitly before the arena is reset.
+/// \param args Constructor parameters.
+/// \return Pointer to the object.
+
+template<class T, class... Args> T* CArena::Create(Args&&... args){
+  return new(Alloc(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+} //Create
+
+#endif //__L4RC_GAME_ARENA_H__
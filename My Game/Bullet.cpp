@@ -3,10 +3,9 @@
 
 #include "Bullet.h"
 #include "ComponentIncludes.h"
-#include "Particle.h"
-#include "ParticleEngine.h"
 #include "Helpers.h"
 #include "ObjectManager.h"
+#include "EmitterManager.h"
 
 /// Create and initialize a bullet object given its initial position.
 /// \param t Sprite type of bullet.
@@ -19,14 +18,10 @@ CBullet::CBullet(eSprite t, const Vector2& p): CObject(t, p){
 
     m_fXScale = m_fYScale = 0.75f;
 
-    m_pFireballEvent = new LEventTimer(0.12f);
+    m_cFireballEvent.Start(0.12f);
 } //constructor
 
 CBullet::~CBullet() {
-  if (m_pFireballEvent) {
-    delete m_pFireballEvent;
-    m_pFireballEvent = nullptr;
-  }
 } //destructor
 
 /// Move and advance current frame number. Create smoke effects as well
@@ -36,66 +31,22 @@ void CBullet::move() {
     return;
   else {
     SmokeFX();
-    const float t = m_pTimer->GetFrameTime();
-    m_vPos += m_vVelocity * t;
-    UpdateFramenumber();
+    UpdateFramenumber(); //position is integrated by the object manager
   }
 }
 
 /// Creates a trailing smoke effect for the bullets 
 
 void CBullet::SmokeFX() {
-  const int count = m_pRandom->randn(0, 10); //gen random amount of dust particles
-  UINT randColor, randSize, randAlpha, randSprite; //random vars
-  float colorVal, alphaVal;
-  LParticleDesc2D dust; //particle descriptor
-  for (int i = 0; i < count; i++) {
-    dust.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-    dust.m_fRoll = m_fFacingVector;
-
-    //fade properties
-    dust.m_fFadeOutFrac = 0.8f;
-    dust.m_fFadeInFrac = 0.2f;
-
-    //get random position within the player sprite
-    dust.m_vPos = GenRandomPosition(0.1f);
-
-    //Trails the origin point of the smoke directly behind the bullet
-    dust.m_vPos += -Vector2(20.0f * cos(m_fRoll), 20.0f * sin(m_fRoll));
-
-    randColor = m_pRandom->randn(0, 5);     //random color 
-    randAlpha = m_pRandom->randn(0, 12);    //random alpha
-    randSize = m_pRandom->randn(1, 12);     //random size
-    randSprite = m_pRandom->randn(0, 5);     //random size
-
-    colorVal = 1.0f - (0.1f * (float)randColor); //calc value to use for color
-    alphaVal = 0.05f * (float)randAlpha;         //calc value to use for alpha
-    dust.m_f4Tint = XMFLOAT4(colorVal, colorVal, colorVal, alphaVal);
-
-    dust.m_fLifeSpan = 0.07f * (float)randAlpha;
-
-    dust.m_fMaxScale = 0.04f * (float)randSize; //apply random scale
-    if (randSprite == 0) {
-      dust.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-      dust.m_fMaxScale = 0.05f * (float)randSize; //apply random scale
-    }
-    else {
-      dust.m_nSpriteIndex = (UINT)eSprite::SmoothCircle;
-      dust.m_fMaxScale = 0.02f * (float)randSize; //apply random scale
-    }
-
-    //spawn particle
-    if(dust.m_nSpriteIndex)
-      m_pParticleEngine->create(dust);
-  } //for
-
-}
+  const SEmitterSource src(m_vPos, m_fRadius, m_fRoll);
+  m_pEmitterManager->Emit(eEmitter::BulletSmoke, src, m_pTimer->GetFrameTime(), m_fSmokeCarry);
+} //SmokeFX
 
 /// Update the frame number in the animation sequence.
 
 void CBullet::UpdateFramenumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
-    if (n > 1 && m_pFireballEvent && m_pFireballEvent->Triggered()) {
+    if (n > 1 && m_cFireballEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     }
 }
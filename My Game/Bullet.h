@@ -15,7 +15,8 @@
 class CBullet: public CObject{
   protected:
 
-    LEventTimer* m_pFireballEvent = nullptr; ///< Event timer for fireball animation
+    CPeriodicTimer m_cFireballEvent; ///< Event timer for fireball animation
+    float m_fSmokeCarry = 0.0f; ///< Fraction of a smoke particle carried to the next frame.
 
     void UpdateFramenumber();
 
@@ -8,12 +8,12 @@
 
 LSpriteRenderer* CCommon::m_pRenderer = nullptr;
 CObjectManager* CCommon::m_pObjectManager = nullptr;
-LParticleEngine2D* CCommon::m_pParticleEngine = nullptr;
+CParticleStore* CCommon::m_pParticleStore = nullptr;
+CEmitterManager* CCommon::m_pEmitterManager = nullptr;
 
-std::priority_queue< CTimedSpawn, std::vector<CTimedSpawn>, std::greater<std::vector<CTimedSpawn>::value_type>> CCommon::m_pTimedEvents;
-//std::priority_queue< CTimedSpawn, 
-//	std::vector<CTimedSpawn>, 
-//	std::less<std::vector<CTimedSpawn>::value_type>>* CCommon::m_pTimedEvents;
+CTimingWheel CCommon::m_cTimedEvents;
+CRandomStream CCommon::m_cEffectsRandom;
+CRandomStream CCommon::m_cAIRandom;
 
 CTileManager* CCommon::m_pTileManager = nullptr;
 bool CCommon::m_bDrawAABBs = false;
@@ -21,14 +21,14 @@ bool CCommon::m_bGodMode = false;
 bool CCommon::m_bInteract = false;
 
 Vector2 CCommon::m_vWorldSize = Vector2::Zero;
-CPlayer* CCommon::m_pPlayer = nullptr;
-CMainMenuExit* CCommon::m_pExitButton = nullptr;
-CMainMenuStart* CCommon::m_pStartButton = nullptr;
-CMainMenuBG* CCommon::m_pBackgroundObj = nullptr;
-CHealthBar* CCommon::m_pHealthBar = nullptr;
-CManaBar* CCommon::m_pManaBar = nullptr;
-CStaminaWheel* CCommon::m_pStaminaWheel = nullptr;
-CHealthPotion* CCommon::m_pHealthPotion = nullptr;
-CManaPotion* CCommon::m_pManaPotion = nullptr;
-CExplosion* CCommon::m_pExplosion = nullptr;
-CExplosion2* CCommon::m_pExplosion2 = nullptr;
+CHandle<CPlayer> CCommon::m_hPlayer;
+CHandle<CMainMenuExit> CCommon::m_hExitButton;
+CHandle<CMainMenuStart> CCommon::m_hStartButton;
+CHandle<CMainMenuBG> CCommon::m_hBackgroundObj;
+CHandle<CHealthBar> CCommon::m_hHealthBar;
+CHandle<CManaBar> CCommon::m_hManaBar;
+CHandle<CStaminaWheel> CCommon::m_hStaminaWheel;
+CHandle<CHealthPotion> CCommon::m_hHealthPotion;
+CHandle<CManaPotion> CCommon::m_hManaPotion;
+CHandle<CExplosion> CCommon::m_hExplosion;
+CHandle<CExplosion2> CCommon::m_hExplosion2;
@@ -5,16 +5,18 @@
 #define __L4RC_GAME_COMMON_H__
 
 #include "Defines.h"
-#include "TimedSpawn.h"
-#include <queue>
+#include "TimingWheel.h"
+#include "ObjectHandle.h"
+#include "RandomStream.h"
 #include <vector>
 
 //forward declarations to make the compiler less stroppy
 
 class CObjectManager;
 class LSpriteRenderer;
-class LParticleEngine2D;
+class CParticleStore;
 class CTileManager;
+class CEmitterManager;
 class CPlayer;
 class CHealthBar;
 class CManaBar;
@@ -26,7 +28,6 @@ class CExplosion2;
 class CMainMenuExit;
 class CMainMenuBG;
 class CMainMenuStart;
-class CTimedSpawn;
 
 /// \brief The common variables class.
 ///
@@ -40,32 +41,49 @@ class CCommon {
 protected:
   static LSpriteRenderer* m_pRenderer; ///< Pointer to renderer.
   static CObjectManager* m_pObjectManager; ///< Pointer to object manager.
-  static LParticleEngine2D* m_pParticleEngine; ///< Pointer to particle engine.    
+  static CParticleStore* m_pParticleStore; ///< Pointer to particle store.
+  static CEmitterManager* m_pEmitterManager; ///< Pointer to particle emitter manager.
 
   static CTileManager* m_pTileManager; ///< Pointer to tile manager. 
   static bool m_bDrawAABBs; ///< Draw AABB flag.
   static bool m_bGodMode; ///< God mode flag.
   static bool m_bInteract;
 
-  /// Store particle effects here if they need to be triggered at a specific time,
-  /// independent of a game objects object's state.
-  /// Min heap priority_queue pointer - juicy O(1) access time. Stores CTimedSpawn 
-  /// objects in std vector. Comparator override of std greater. 
-  static std::priority_queue< CTimedSpawn, std::vector<CTimedSpawn>, 
-      std::greater<std::vector<CTimedSpawn>::value_type>> m_pTimedEvents;
+  /// Schedule particle effects, object spawns, sounds and function calls here
+  /// if they need to be triggered after a delay in simulation time,
+  /// independent of a game object's state. Insertion is O(1), and `CGame` fires the events that
+  /// are due each tick in one batch.
+  static CTimingWheel m_cTimedEvents;
+
+  /// Random number streams, one per subsystem, seeded together by `CGame`
+  /// from the `-seed` command line option or the clock. Anything that
+  /// changes the state of the game, such as enemy movement, periodic timer
+  /// jitter, spawns, drops and bullet deflection, draws from the gameplay
+  /// stream. Particle effects and camera shake draw from the effects
+  /// stream, so that adding an effect doesn't change how the game plays.
+  /// Given the same seed, input and frame times, a session draws the same
+  /// gameplay random numbers.
+
+  static CRandomStream m_cEffectsRandom; ///< Random numbers for particle effects and camera shake.
+  static CRandomStream m_cAIRandom; ///< Random numbers for gameplay.
 
   static Vector2 m_vWorldSize; ///< World height and width.
-  static CPlayer* m_pPlayer; ///< Pointer to player character.
-  static CHealthBar* m_pHealthBar; ///< Pointer to player Healthbar
-  static CManaBar* m_pManaBar; ///< Pointer to player Manabar
-  static CStaminaWheel* m_pStaminaWheel; ///< Pointer to player Stamina Wheel
-  static CHealthPotion* m_pHealthPotion; ///< Pointer to HealthPotion
-  static CManaPotion* m_pManaPotion; ///< Pointer to ManaPotion
-  static CMainMenuExit* m_pExitButton; ///< Pointer to the Exit Button
-  static CMainMenuStart* m_pStartButton; ///< Pointer to the Start Button
-  static CMainMenuBG* m_pBackgroundObj; ///< Pointer to the background for the menu
-  static CExplosion* m_pExplosion; ///< Pointer to an explosion
-  static CExplosion2* m_pExplosion2; ///< Pointer to a different explosion
+
+  /// Handles to objects that other objects need to find. A handle resolves
+  /// to null once its object has been deleted, so these never dangle, but
+  /// they must still be checked before use.
+
+  static CHandle<CPlayer> m_hPlayer; ///< Handle to player character.
+  static CHandle<CHealthBar> m_hHealthBar; ///< Handle to player Healthbar
+  static CHandle<CManaBar> m_hManaBar; ///< Handle to player Manabar
+  static CHandle<CStaminaWheel> m_hStaminaWheel; ///< Handle to player Stamina Wheel
+  static CHandle<CHealthPotion> m_hHealthPotion; ///< Handle to HealthPotion
+  static CHandle<CManaPotion> m_hManaPotion; ///< Handle to ManaPotion
+  static CHandle<CMainMenuExit> m_hExitButton; ///< Handle to the Exit Button
+  static CHandle<CMainMenuStart> m_hStartButton; ///< Handle to the Start Button
+  static CHandle<CMainMenuBG> m_hBackgroundObj; ///< Handle to the background for the menu
+  static CHandle<CExplosion> m_hExplosion; ///< Handle to an explosion
+  static CHandle<CExplosion2> m_hExplosion2; ///< Handle to a different explosion
 }; //CCommon
 
 /// <summary>
@@ -153,7 +171,8 @@ enum class eObjectType {
     OBSTACLE,
     UI,
     LOCKBLOCK,
-    EXPLOSION
+    EXPLOSION,
+    Size  //MUST BE LAST
 }; //eObjectType
 
 #endif //__L4RC_GAME_COMMON_H__
\ No newline at end of file
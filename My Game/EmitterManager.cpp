@@ -0,0 +1,335 @@
+/// \file EmitterManager.cpp
+/// \brief Code for the particle emitter manager CEmitterManager.
+
+#include <algorithm>
+#include <cassert>
+
+#include "EmitterManager.h"
+#include "ComponentIncludes.h"
+#include "ParticleStore.h"
+
+static const float VISIBLE_MARGIN = 128.0f; ///< Allowance for particle size and drift when culling effects.
+
+/// Construct an emitter source.
+/// \param pos Position.
+/// \param r Radius.
+/// \param roll Direction the source is facing.
+/// \param vel Velocity added to every particle.
+
+SEmitterSource::SEmitterSource(const Vector2& pos, float r, float roll, const Vector2& vel):
+  m_vPos(pos), m_fRadius(r), m_fRoll(roll), m_vVel(vel){
+} //constructor
+
+/// Fill in the emitter descriptors and reserve space for the largest burst.
+
+CEmitterManager::CEmitterManager(){
+  LoadDescriptors();
+
+  UINT n = 0; //largest burst
+
+  for(const SEmitterDesc& d: m_sDesc)
+    n = std::max<UINT>(n, d.m_rCount.m_nMax);
+
+  m_vecBatch.reserve(n);
+} //constructor
+
+/// Fill in the emitter descriptors. These reproduce the hand-written
+/// effects that they replace.
+
+void CEmitterManager::LoadDescriptors(){
+  { //smoke trailing behind bullets
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::BulletSmoke];
+
+    d.m_eCategory = eParticleCategory::Trail;
+    d.m_rCount = {0, 10};
+    d.m_fRate = 300.0f; //averages the old 0 to 10 per frame at 60 fps
+    d.m_cBase.m_fFadeInFrac = 0.2f;
+    d.m_cBase.m_fFadeOutFrac = 0.8f;
+    d.m_cBase.m_fLifeSpan = 0.0f;
+    d.m_cBase.m_fMaxScale = 0.0f;
+    d.m_cBase.m_f4Tint.w = 0.0f;
+
+    d.m_eSprite[0] = eSprite::CircleNoBorder;
+    d.m_eSprite[1] = eSprite::SmoothCircle;
+    d.m_fScaleStep[0] = 0.05f;
+    d.m_fScaleStep[1] = 0.02f;
+    d.m_nSpriteOdds = 6;
+
+    d.m_nPaletteSize = 6;
+
+    for(UINT i=0; i<d.m_nPaletteSize; i++){ //shades of gray
+      const float f = 1.0f - 0.1f*i;
+      d.m_f4Palette[i] = XMFLOAT4(f, f, f, 0.0f);
+    } //for
+
+    d.m_rSize = {1, 12};
+    d.m_rLevel = {0, 12};
+    d.m_fAlphaStep = 0.05f;
+    d.m_fLifeStep = 0.07f;
+
+    d.m_fSpread = 0.1f;
+    d.m_fTrail = 20.0f;
+  } //BulletSmoke
+
+  { //dust kicked up by the player's feet
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::PlayerRun];
+
+    d.m_eCategory = eParticleCategory::Ambience;
+    d.m_rCount = {1, 1};
+    d.m_cBase.m_fFadeInFrac = 0.01f;
+    d.m_cBase.m_fFadeOutFrac = 0.8f;
+    d.m_cBase.m_fAlpha = 0.01f; //should be quite see-through
+    d.m_cBase.m_fLifeSpan = 0.0f;
+    d.m_cBase.m_fMaxScale = 0.0f;
+    d.m_cBase.m_f4Tint.w = 0.0f;
+
+    d.m_eSprite[0] = eSprite::CircleNoBorder;
+    d.m_eSprite[1] = eSprite::SmoothCircle;
+    d.m_fScaleStep[0] = 0.05f;
+    d.m_fScaleStep[1] = 0.02f;
+    d.m_nSpriteOdds = 6;
+
+    d.m_f4Palette[0] = XMFLOAT4(0.414f, 0.33f, 0.3012f, 0.0f);
+    d.m_nPaletteSize = 1;
+
+    d.m_rSize = {1, 12};
+    d.m_rLevel = {0, 100};
+    d.m_fLifeStep = 0.015f;
+
+    d.m_fSpread = 0.2f;
+    d.m_vOffset = Vector2(0.0f, -1.0f); //at the feet
+    d.m_fTrail = 20.0f;
+  } //PlayerRun
+
+  { //blood around the player
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::PlayerDamage];
+
+    d.m_eCategory = eParticleCategory::Combat;
+    d.m_rCount = {0, 12};
+    d.m_cBase.m_fFadeInFrac = 0.1f;
+    d.m_cBase.m_fFadeOutFrac = 0.9f;
+    d.m_cBase.m_fLifeSpan = 5.0f;
+    d.m_cBase.m_fMaxScale = 0.2f;
+    d.m_cBase.m_f4Tint.w = 0.6f;
+
+    d.m_eSprite[0] = eSprite::CircleNoBorder;
+    d.m_fScaleStep[0] = 0.1f;
+
+    d.m_f4Palette[0] = XMFLOAT4(0.651f, 0.063f, 0.118f, 0.0f); //blood red
+    d.m_nPaletteSize = 1;
+
+    d.m_rSize = {0, 2};
+
+    d.m_fSpread = 0.4f;
+    d.m_vOffset = Vector2(0.0f, -0.75f);
+  } //PlayerDamage
+
+  { //crosses rising from the player
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::PlayerHeal];
+
+    d.m_eCategory = eParticleCategory::Ambience;
+    d.m_rCount = {2, 5};
+    d.m_cBase.m_fFadeInFrac = 0.1f;
+    d.m_cBase.m_fFadeOutFrac = 0.4f;
+    d.m_cBase.m_fLifeSpan = 1.0f;
+    d.m_cBase.m_fMaxScale = 0.0f;
+    d.m_cBase.m_f4Tint.w = 0.8f;
+
+    d.m_eSprite[0] = eSprite::Cross;
+    d.m_fScaleStep[0] = 0.1f;
+
+    d.m_f4Palette[0] = XMFLOAT4(Colors::Green);
+    d.m_f4Palette[1] = XMFLOAT4(Colors::GreenYellow);
+    d.m_f4Palette[2] = XMFLOAT4(Colors::ForestGreen);
+    d.m_nPaletteSize = 3;
+
+    d.m_rSize = {4, 15};
+
+    d.m_fSpread = 0.6f;
+    d.m_vVelScale = Vector2(5.0f, 30.0f);
+    d.m_bUpward = true;
+  } //PlayerHeal
+
+  { //mana sparks rising from the top of the player
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::PlayerMana];
+
+    d.m_eCategory = eParticleCategory::Ambience;
+    d.m_rCount = {3, 8};
+    d.m_cBase.m_fFadeInFrac = 0.2f;
+    d.m_cBase.m_fFadeOutFrac = 0.8f;
+    d.m_cBase.m_fLifeSpan = 1.2f;
+    d.m_cBase.m_fMaxScale = 0.0f;
+    d.m_cBase.m_f4Tint.w = 0.8f;
+
+    d.m_eSprite[0] = eSprite::ManaParticles;
+    d.m_fScaleStep[0] = 0.1f;
+    d.m_nMaxFrame = 7;
+
+    d.m_f4Palette[0] = XMFLOAT4(Colors::Violet);
+    d.m_f4Palette[1] = XMFLOAT4(Colors::DeepPink);
+    d.m_f4Palette[2] = XMFLOAT4(Colors::DarkGoldenrod);
+    d.m_nPaletteSize = 3;
+
+    d.m_rSize = {12, 22};
+
+    d.m_fSpread = 0.45f;
+    d.m_vOffset = Vector2(0.0f, -0.625f);
+    d.m_vVelScale = Vector2(20.0f, 100.0f);
+    d.m_bUpward = true;
+  } //PlayerMana
+
+  { //blood around a slime's corpse
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::SlimeDeath];
+
+    d.m_eCategory = eParticleCategory::Combat;
+    d.m_rCount = {8, 16};
+    d.m_cBase.m_fFadeInFrac = 0.2f;
+    d.m_cBase.m_fFadeOutFrac = 0.8f;
+    d.m_cBase.m_fLifeSpan = 4.0f;
+    d.m_cBase.m_fMaxScale = 0.2f;
+    d.m_cBase.m_f4Tint.w = 0.6f;
+
+    d.m_eSprite[0] = eSprite::CircleNoBorder;
+    d.m_fScaleStep[0] = 0.05f;
+
+    d.m_f4Palette[0] = XMFLOAT4(Colors::Black);
+    d.m_f4Palette[1] = XMFLOAT4(Colors::DarkRed);
+    d.m_f4Palette[2] = XMFLOAT4(Colors::Red);
+    d.m_nPaletteSize = 3;
+
+    d.m_rSize = {0, 2};
+
+    d.m_fSpread = 0.3f;
+    d.m_vOffset = Vector2(-0.25f, -1.0f);
+  } //SlimeDeath
+
+  { //blood spattered around a rabite or oak seed's corpse
+    SEmitterDesc& d = m_sDesc[(UINT)eEmitter::CritterDeath];
+
+    d = m_sDesc[(UINT)eEmitter::SlimeDeath];
+    d.m_rCount = {0, 10};
+    d.m_rSize = {0, 3};
+    d.m_fMaxScale = 0.3f;
+    d.m_fSpread = 10.0f;
+    d.m_vOffset = Vector2::Zero;
+  } //CritterDeath
+
+  for(const SEmitterDesc& d: m_sDesc)
+    assert(d.m_nPaletteSize <= SEmitterDesc::MAX_PALETTE);
+} //LoadDescriptors
+
+/// Choose a random integer from a range, without calling the random number
+/// generator if there is nothing to choose from.
+/// \param r Range.
+/// \return Random integer in the range.
+
+const UINT CEmitterManager::Roll(const SEmitterRange& r) const{
+  return r.m_nMin < r.m_nMax? m_cEffectsRandom.randn(r.m_nMin, r.m_nMax): r.m_nMin;
+} //Roll
+
+/// Determine whether any particle of an effect could be seen, from a bound
+/// on how far its particles start from the source plus a margin for their
+/// size and movement.
+/// \param d Emitter descriptor.
+/// \param src Emitter source.
+/// \return true if the effect could overlap the window.
+
+const bool CEmitterManager::IsVisible(const SEmitterDesc& d, const SEmitterSource& src) const{
+  const float reach = src.m_fRadius*(2.0f*d.m_fSpread + d.m_vOffset.Length()) + d.m_fTrail +
+    src.m_vVel.Length()*(d.m_cBase.m_fLifeSpan + d.m_fLifeStep*d.m_rLevel.m_nMax) + VISIBLE_MARGIN; //bound on distance from source
+
+  return m_pParticleStore->IsVisible(src.m_vPos, reach);
+} //IsVisible
+
+/// Generate particles from a descriptor and append them to the batch.
+/// The position spread matches `CObject::GenRandomPosition()`.
+/// \param d Emitter descriptor.
+/// \param src Emitter source.
+/// \param n Number of particles.
+
+void CEmitterManager::Generate(const SEmitterDesc& d, const SEmitterSource& src, UINT n){
+  const float spread = src.m_fRadius*d.m_fSpread/16.0f; //position step
+  const Vector2 origin = src.m_vPos + src.m_fRadius*d.m_vOffset -
+    d.m_fTrail*Vector2(cosf(src.m_fRoll), sinf(src.m_fRoll));
+  const bool bMoving = d.m_vVelScale != Vector2::Zero; //random velocity
+
+  m_vecOffset.resize(2*n);
+  m_cEffectsRandom.FillInts(m_vecOffset.data(), 2*n, 0, 31); //x and y offsets in one batch
+
+  for(UINT k=0; k<n; k++){
+    m_vecBatch.push_back(d.m_cBase);
+    LParticleDesc2D& p = m_vecBatch.back();
+
+    const UINT s = d.m_nSpriteOdds > 1 && m_cEffectsRandom.randn(0, d.m_nSpriteOdds - 1) > 0; //sprite
+    p.m_nSpriteIndex = (UINT)d.m_eSprite[s];
+    p.m_nCurrentFrame = Roll({0, d.m_nMaxFrame});
+
+    const UINT mx = m_vecOffset[2*k]; //x offset
+    const UINT my = m_vecOffset[2*k + 1]; //y offset
+    p.m_vPos = origin + spread*Vector2(mx < 16? (float)mx: -(float)mx, my < 16? (float)my: -(float)my);
+
+    const UINT level = Roll(d.m_rLevel); //alpha and lifespan level
+
+    if(d.m_nPaletteSize > 0) //else keep the base tint
+      p.m_f4Tint = d.m_f4Palette[Roll({0, d.m_nPaletteSize - 1})];
+
+    p.m_f4Tint.w = d.m_cBase.m_f4Tint.w + d.m_fAlphaStep*level;
+    p.m_fLifeSpan = d.m_cBase.m_fLifeSpan + d.m_fLifeStep*level;
+
+    p.m_fMaxScale = d.m_cBase.m_fMaxScale + d.m_fScaleStep[s]*Roll(d.m_rSize);
+
+    if(d.m_fMaxScale > 0.0f)
+      p.m_fMaxScale = std::min<float>(p.m_fMaxScale, d.m_fMaxScale);
+
+    p.m_vVel = src.m_vVel;
+
+    if(bMoving){
+      Vector2 v = m_cEffectsRandom.randv();
+      v *= d.m_vVelScale;
+      if(d.m_bUpward)v.y = fabsf(v.y);
+      p.m_vVel += v;
+    } //if
+  } //for
+} //Generate
+
+/// Hand the batch of particles to the particle store in one call and empty it.
+/// \param c Budget category of the particles.
+
+void CEmitterManager::Submit(eParticleCategory c){
+  m_pParticleStore->create(m_vecBatch.data(), m_vecBatch.size(), c);
+  m_vecBatch.clear();
+} //Submit
+
+/// Emit a burst of particles with a random count, unless it can't be seen.
+/// \param t Emitter type.
+/// \param src Emitter source.
+
+void CEmitterManager::Emit(eEmitter t, const SEmitterSource& src){
+  const SEmitterDesc& d = m_sDesc[(UINT)t];
+  if(!IsVisible(d, src))return;
+
+  Generate(d, src, Roll(d.m_rCount));
+  Submit(d.m_eCategory);
+} //Emit
+
+/// Emit particles continuously at the emitter's rate. The fraction of a
+/// particle left over is carried to the next call, so the number emitted
+/// doesn't depend on the frame rate. No more than the largest burst is
+/// emitted at once, so a long frame doesn't leave a clump. While the source
+/// can't be seen its particles are counted off but not generated.
+/// \param t Emitter type.
+/// \param src Emitter source.
+/// \param dt Time since the last call.
+/// \param carry [in, out] Fraction of a particle carried over, owned by the caller.
+
+void CEmitterManager::Emit(eEmitter t, const SEmitterSource& src, float dt, float& carry){
+  const SEmitterDesc& d = m_sDesc[(UINT)t];
+  carry += d.m_fRate*dt;
+  const UINT n = (UINT)carry;
+  carry -= (float)n;
+
+  if(!IsVisible(d, src))return;
+
+  Generate(d, src, std::min<UINT>(n, d.m_rCount.m_nMax));
+  Submit(d.m_eCategory);
+} //Emit
@@ -0,0 +1,112 @@
+/// \file EmitterManager.h
+/// \brief Interface for the particle emitter manager CEmitterManager.
+
+#ifndef __L4RC_GAME_EMITTERMANAGER_H__
+#define __L4RC_GAME_EMITTERMANAGER_H__
+
+#include <vector>
+
+#include "Common.h"
+#include "Component.h"
+#include "Particle.h"
+#include "GameDefines.h"
+
+/// \brief Particle emitter type.
+
+enum class eEmitter{
+  BulletSmoke, PlayerRun, PlayerDamage, PlayerHeal, PlayerMana,
+  SlimeDeath, CritterDeath,
+  Size  //MUST BE LAST
+}; //eEmitter
+
+/// \brief An inclusive range of random integers.
+
+struct SEmitterRange{
+  UINT m_nMin = 0; ///< Smallest value.
+  UINT m_nMax = 0; ///< Largest value.
+}; //SEmitterRange
+
+/// \brief Emitter descriptor.
+///
+/// Everything needed to generate an effect's particles. Fields that don't
+/// vary are kept in a particle descriptor that is copied as is. The rest
+/// are ranges of random integers and the steps by which they scale a
+/// property, so that generating a particle takes no branches beyond the
+/// ones that skip ranges with nothing to choose from.
+
+struct SEmitterDesc{
+  static const UINT MAX_PALETTE = 6; ///< Maximum number of tints.
+
+  LParticleDesc2D m_cBase; ///< Properties that don't vary.
+  eParticleCategory m_eCategory = eParticleCategory::Combat; ///< Budget category.
+
+  SEmitterRange m_rCount; ///< Number of particles per burst.
+  float m_fRate = 0.0f; ///< Particles per second when emitting continuously.
+
+  eSprite m_eSprite[2] = {eSprite::Size, eSprite::Size}; ///< Sprites.
+  float m_fScaleStep[2] = {0.0f, 0.0f}; ///< Scale step for each sprite.
+  UINT m_nSpriteOdds = 0; ///< One in this many particles use the first sprite, zero for all.
+  UINT m_nMaxFrame = 0; ///< Largest random frame number.
+
+  XMFLOAT4 m_f4Palette[MAX_PALETTE]; ///< Tints, alpha ignored.
+  UINT m_nPaletteSize = 0; ///< Number of tints in the palette, zero for the base tint.
+
+  SEmitterRange m_rSize; ///< Random scale multiplier.
+  float m_fMaxScale = 0.0f; ///< Largest scale, zero for no limit.
+
+  SEmitterRange m_rLevel; ///< Random level for tint alpha and lifespan.
+  float m_fAlphaStep = 0.0f; ///< Tint alpha added per level.
+  float m_fLifeStep = 0.0f; ///< Lifespan added per level.
+
+  float m_fSpread = 0.0f; ///< Position spread as a multiple of the source radius.
+  Vector2 m_vOffset; ///< Position offset as a multiple of the source radius.
+  float m_fTrail = 0.0f; ///< Distance behind the source.
+
+  Vector2 m_vVelScale; ///< Scale of the random velocity.
+  bool m_bUpward = false; ///< Whether the random velocity points upward.
+}; //SEmitterDesc
+
+/// \brief Where and how an effect is emitted.
+
+struct SEmitterSource{
+  Vector2 m_vPos; ///< Position.
+  float m_fRadius = 0.0f; ///< Radius.
+  float m_fRoll = 0.0f; ///< Direction the source is facing.
+  Vector2 m_vVel; ///< Velocity added to every particle.
+
+  SEmitterSource(const Vector2&, float, float=0.0f, const Vector2& =Vector2::Zero); ///< Constructor.
+}; //SEmitterSource
+
+/// \brief The particle emitter manager.
+///
+/// Generates particle effects from a table of emitter descriptors, one for
+/// each emitter type. Gameplay code triggers an effect by type, either as a
+/// burst or at a rate that is carried over between frames. The particles
+/// for a trigger are generated into a reused batch and then handed to the
+/// particle store together. Effects that are too far from the window to be
+/// seen are skipped before any particles are generated.
+
+class CEmitterManager:
+  public CCommon,
+  public LComponent
+{
+  private:
+    SEmitterDesc m_sDesc[(UINT)eEmitter::Size]; ///< Emitter descriptors.
+    std::vector<LParticleDesc2D> m_vecBatch; ///< Particles to be created.
+    std::vector<UINT> m_vecOffset; ///< Random position offsets for the batch.
+
+    void LoadDescriptors(); ///< Fill in the emitter descriptors.
+
+    const UINT Roll(const SEmitterRange&) const; ///< Choose from a range.
+    const bool IsVisible(const SEmitterDesc&, const SEmitterSource&) const; ///< Whether an effect can be seen.
+    void Generate(const SEmitterDesc&, const SEmitterSource&, UINT); ///< Generate particles.
+    void Submit(eParticleCategory); ///< Create the batch of particles.
+
+  public:
+    CEmitterManager(); ///< Constructor.
+
+    void Emit(eEmitter, const SEmitterSource&); ///< Emit a burst.
+    void Emit(eEmitter, const SEmitterSource&, float, float&); ///< Emit continuously.
+}; //CEmitterManager
+
+#endif //__L4RC_GAME_EMITTERMANAGER_H__
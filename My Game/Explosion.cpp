@@ -20,17 +20,13 @@ CExplosion::CExplosion(eSprite t, const Vector2& p) : CObject(t, p) {
   m_fXScale = m_fYScale = 0.2f;
   m_fRadius = m_fXScale;
 
-  m_fRoll = m_pPlayer->GetFacingVectorAtShot() + XM_PI/2;
-  m_vPos += -Vector2(20.0f * cos(m_pPlayer->GetFacingVectorAtShot())), 20.0f * sin(m_pPlayer->GetFacingVectorAtShot());
+  m_fRoll = m_hPlayer->GetFacingVectorAtShot() + XM_PI/2;
+  m_vPos += -Vector2(20.0f * cos(m_hPlayer->GetFacingVectorAtShot())), 20.0f * sin(m_hPlayer->GetFacingVectorAtShot());
 
-  m_pExplosionEvent = new LEventTimer(0.06f);
+  m_cExplosionEvent.Start(0.06f);
 } //constructor
 
 CExplosion::~CExplosion() {
-  if (m_pExplosionEvent) {
-    delete m_pExplosionEvent;
-    m_pExplosionEvent = nullptr;
-  }
 } //destructor
 
 /// Move and advance current frame number. 
@@ -47,7 +43,7 @@ void CExplosion::move() {
 
 void CExplosion::UpdateFramenumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
-  if (n > 1 && m_pExplosionEvent && m_pExplosionEvent->Triggered()) {
+  if (n > 1 && m_cExplosionEvent.Triggered()) {
     m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     if (m_nCurrentFrame == (n - 1)) {
       m_bDead = true;
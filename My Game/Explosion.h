@@ -14,7 +14,7 @@
 class CExplosion : public CObject {
 protected:
 
-  LEventTimer* m_pExplosionEvent = nullptr;
+  CPeriodicTimer m_cExplosionEvent;
 
   void UpdateFramenumber();
 
@@ -22,14 +22,10 @@ CExplosion3::CExplosion3(eSprite t, const Vector2& p) : CObject(t, p) {
 
   m_fRoll = 0.0f;
 
-  m_pExplosionEvent = new LEventTimer(0.06f);
+  m_cExplosionEvent.Start(0.06f);
 } //constructor
 
 CExplosion3::~CExplosion3() {
-  if (m_pExplosionEvent) {
-    delete m_pExplosionEvent;
-    m_pExplosionEvent = nullptr;
-  }
 } //destructor
 
 /// Move and advance current frame number. 
@@ -46,7 +42,7 @@ void CExplosion3::move() {
 
 void CExplosion3::UpdateFramenumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
-  if (n > 1 && m_pExplosionEvent && m_pExplosionEvent->Triggered()) {
+  if (n > 1 && m_cExplosionEvent.Triggered()) {
     m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     if (m_nCurrentFrame == (n - 1)) {
       m_bDead = true;
@@ -14,7 +14,7 @@
 class CExplosion3 : public CObject {
 protected:
 
-  LEventTimer* m_pExplosionEvent = nullptr;
+  CPeriodicTimer m_cExplosionEvent;
 
   void UpdateFramenumber();
 
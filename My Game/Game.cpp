@@ -3,10 +3,12 @@
 
 #include "Game.h"
 
+#include <chrono>
+
 #include "GameDefines.h"
 #include "SpriteRenderer.h"
 #include "ComponentIncludes.h"
-#include "ParticleEngine.h"
+#include "ParticleStore.h"
 #include "Player.h" // ADDED FOR SPRITE ANIMATION
 #include "Slime.h"
 #include "TileManager.h"
@@ -23,12 +25,14 @@
 #include "FadeInObject.h"
 #include "FadeOutObject.h"
 #include "GameOverObject.h"
+#include "EmitterManager.h"
 
-/// Delete the particle engine and the object manager. The renderer needs to
+/// Delete the particle store and the object manager. The renderer needs to
 /// be deleted before this destructor runs so it will be done elsewhere.
 
 CGame::~CGame() {
-  delete m_pParticleEngine;
+  delete m_pEmitterManager;
+  delete m_pParticleStore;
   delete m_pObjectManager;
   delete m_pTileManager;
 } //destructor
@@ -39,7 +43,7 @@ CGame::~CGame() {
 /// </summary>
 
 void CGame::GameOver() {
-    Vector2 cPos = Vec3toVec2(m_pRenderer->GetCameraPos());
+    const Vector2 cPos(m_nWinWidth / 2.0f, m_nWinHeight / 2.0f); //screen center
     //m_pObjectManager->clear();
     m_pObjectManager->create(eSprite::GameOver, cPos);
     if (state != eMusicState::GAMEOVER) {
@@ -56,7 +60,7 @@ void CGame::GameOver() {
 /// </summary>
 
 void CGame::FinishGame() {
-    m_pObjectManager->create(eSprite::EndingScreen, Vec3toVec2(m_pRenderer->GetCameraPos()));
+    m_pObjectManager->create(eSprite::EndingScreen, Vector2(m_nWinWidth / 2.0f, m_nWinHeight / 2.0f));
     m_bAtEndScreen = true;
     oneTimeReset = true;
 }
@@ -97,7 +101,7 @@ void CGame::Goto(int level_index) {
 
 }
 
-/// Create the renderer, the object manager, and the particle engine, load
+/// Create the renderer, the object manager, and the particle store, load
 /// images and sounds, and begin the game.
 /// 
 /// LEVEL FORMAT
@@ -154,7 +158,14 @@ void CGame::Initialize() {
   m_pObjectManager = new CObjectManager; //set up the object manager 
   LoadSounds(); //load the sounds for this game
 
-  m_pParticleEngine = new LParticleEngine2D(m_pRenderer);
+  const UINT64 seed = m_bSeedGiven? m_nSeed: //random seed, from the command line or the clock
+    (UINT64)std::chrono::high_resolution_clock::now().time_since_epoch().count();
+  m_cEffectsRandom.Seed(seed, 1);
+  m_cAIRandom.Seed(seed, 2);
+  printf("Random seed %llu\n", seed);
+
+  m_pParticleStore = new CParticleStore;
+  m_pEmitterManager = new CEmitterManager;
   m_bInMenu = true;
   m_pAudio->loop(eSound::Story);
   state = eMusicState::STORY;
@@ -162,6 +173,16 @@ void CGame::Initialize() {
 
 } //Initialize
 
+/// Set the random seed that `Initialize()` seeds the random number streams
+/// with, so that a session's random numbers can be reproduced. If this is
+/// not called then the seed is taken from the clock.
+/// \param seed Random seed.
+
+void CGame::SetSeed(UINT64 seed) {
+  m_nSeed = seed;
+  m_bSeedGiven = true;
+} //SetSeed
+
 void CGame::Pause() {
     m_bInMenu = !m_bInMenu;
 }
@@ -727,10 +748,10 @@ void CGame::CreateMenu() {
     m_bMainMenu = true;
     m_pObjectManager->clear();
     printf("Making menu\n");
-    m_pBackgroundObj = (CMainMenuBG*)m_pObjectManager->create(eSprite::BG, Vector2(512.0, 390.0));
+    m_hBackgroundObj = (CMainMenuBG*)m_pObjectManager->create(eSprite::BG, Vector2(512.0, 390.0));
 
-    m_pExitButton = (CMainMenuExit*)m_pObjectManager->create(eSprite::Exit, Vector2(102.0, 58.0));
-    m_pStartButton = (CMainMenuStart*)m_pObjectManager->create(eSprite::Start, Vector2(102.0, 88.0));
+    m_hExitButton = (CMainMenuExit*)m_pObjectManager->create(eSprite::Exit, Vector2(102.0, 58.0));
+    m_hStartButton = (CMainMenuStart*)m_pObjectManager->create(eSprite::Start, Vector2(102.0, 88.0));
 }
 
 /// <summary>
@@ -746,20 +767,23 @@ void CGame::CreateObjects() {
   Vector2 playerpos; //player positions
   m_pTileManager->GetObjects(turretpos, playerpos, spikespos, exit_portal, entry_portal, bigPos,
       slimePos, kingPos, oakPos, rabitePos); //get positions
-  
-  m_pPlayer = (CPlayer*)m_pObjectManager->create(eSprite::Player, playerpos);
 
-  m_pHealthBar = (CHealthBar*)m_pObjectManager->create(eSprite::HealthBarFull, Vector2(playerpos.x - (m_nWinWidth / 2.0f) + 125.0f, playerpos.y - (m_nWinHeight / 2.0f) + 75.0f));
-  m_pHealthBar->m_fRoll = 0.0f;
-  m_pHealthBar->m_fXScale = m_pHealthBar->m_fYScale = 1.5f;
+  m_pObjectManager->BeginLevelLoad(); //the level's objects go in the arena
+  m_hPlayer = (CPlayer*)m_pObjectManager->create(eSprite::Player, playerpos);
 
-  m_pManaBar = (CManaBar*)m_pObjectManager->create(eSprite::ManaBarFull, Vector2(playerpos.x + (m_nWinWidth / 2.0f) - 125.0f, playerpos.y - (m_nWinHeight / 2.0f) + 75.0f));
-  m_pManaBar->m_fRoll = 0.0f;
-  m_pManaBar->m_fXScale = m_pManaBar->m_fYScale = 1.5f;
+  //HUD elements live in the overlay, so their positions are in screen space
 
-  m_pStaminaWheel = (CStaminaWheel*)m_pObjectManager->create(eSprite::StaminaWheelFull, Vector2(playerpos.x + (m_nWinWidth / 2.0f) - 125.0f, playerpos.y - (m_nWinHeight / 2.0f) + 50.0f));
-  m_pStaminaWheel->m_fRoll = 0.0f;
-  m_pStaminaWheel->m_fXScale = m_pStaminaWheel->m_fYScale = 1.5f;
+  m_hHealthBar = (CHealthBar*)m_pObjectManager->create(eSprite::HealthBarFull, Vector2(125.0f, 75.0f));
+  m_hHealthBar->m_fRoll = 0.0f;
+  m_hHealthBar->m_fXScale = m_hHealthBar->m_fYScale = 1.5f;
+
+  m_hManaBar = (CManaBar*)m_pObjectManager->create(eSprite::ManaBarFull, Vector2(m_nWinWidth - 125.0f, 75.0f));
+  m_hManaBar->m_fRoll = 0.0f;
+  m_hManaBar->m_fXScale = m_hManaBar->m_fYScale = 1.5f;
+
+  m_hStaminaWheel = (CStaminaWheel*)m_pObjectManager->create(eSprite::StaminaWheelFull, Vector2(m_nWinWidth / 2.0f, 65.0f)); // Centered
+  m_hStaminaWheel->m_fRoll = 0.0f;
+  m_hStaminaWheel->m_fXScale = m_hStaminaWheel->m_fYScale = 1.5f;
 
   if (entry_portal.Length() > 0) 
       m_pObjectManager->create(eSprite::PrevPortal, entry_portal);
@@ -782,6 +806,10 @@ void CGame::CreateObjects() {
       m_pObjectManager->create(eSprite::OakSeed, pos);
   for (const Vector2& pos : rabitePos)
       m_pObjectManager->create(eSprite::Rabite, pos);
+
+  m_pObjectManager->BuildStaticGrid(); //turrets, portals and the like never move
+  m_pObjectManager->ReservePools(); //bullets and explosions, sized by turret count
+  m_pObjectManager->EndLevelLoad(); //anything spawned from now on goes on the heap
   /*std::vector<Vector2> slime_positions;
   slime_positions.push_back(Vector2(680.0f, 515.0f));
   slime_positions.push_back(Vector2(730.0f, 500.0f));
@@ -827,25 +855,54 @@ void CGame::SpawnMany(eSprite type, std::vector<Vector2> positions) {
     }
 }
 
+/// Collect the timed events that are due from the timing wheel in one batch
+/// and fire them in the order they were due.
+
+void CGame::FireTimedEvents() {
+  m_cTimedEvents.Advance(m_pTimer->GetFrameTime(), m_vecDueEvents);
+
+  for (STimedEvent& e : m_vecDueEvents) {
+    switch (e.m_eType) {
+      case eTimedEvent::Particle: m_pParticleStore->create(e.m_cParticle.m_cDesc, e.m_cParticle.m_eCategory); break;
+      case eTimedEvent::Spawn: m_pObjectManager->create(e.m_cSpawn.m_eSprite, e.m_cSpawn.m_vPos); break;
+      case eTimedEvent::Sound: m_pAudio->play(e.m_eSound); break;
+      case eTimedEvent::Callback: e.m_fnCallback(); break;
+    } //switch
+  } //for
+
+  m_vecDueEvents.clear();
+} //FireTimedEvents
+
 /// Call this function to start a new game. This should be re-entrant so that
 /// you can restart a new game without having to shut down and restart the
-/// program. Clear the particle engine to get rid of any existing particles,
+/// program. Clear the particle store to get rid of any existing particles,
 /// delete any old objects out of the object manager and create some new ones.
+/// The time taken to tear down the old level and build the new one, and the
+/// level arena's memory use, are printed to the console.
 
 void CGame::BeginGame() {
     printf("BeginGame called\n");
-    if (m_pPlayer) {
-        printf("Player port: %d\n", m_pPlayer->GetPort());
+    if (m_hPlayer) {
+        printf("Player port: %d\n", m_hPlayer->GetPort());
         printf("Map being loaded: %s\n", maps[m_nCurrentLevelIndex]);
     }
+  const auto start = std::chrono::high_resolution_clock::now(); //start of level transition
   m_pObjectManager->clear(); //clear old objects
 
-  m_pParticleEngine->clear(); //clear old particles
+  m_pParticleStore->clear(); //clear old particles
+  m_cTimedEvents.clear(); //and anything scheduled in the old level
 
   m_pTileManager->LoadMap(maps[m_nCurrentLevelIndex], mapmasks[m_nCurrentLevelIndex], flavor[m_nCurrentLevelIndex] ,masks[m_nCurrentLevelIndex], m_nPortDirection);
   m_pRenderer->SetCameraPos(m_vInitCameraPos);
   t = false;
   CreateObjects();
+
+  const std::chrono::duration<double, std::milli> ms =
+    std::chrono::high_resolution_clock::now() - start; //level transition time
+  const CArena& arena = m_pObjectManager->GetArena(); //level arena
+  printf("Level loaded in %.2f ms, arena %zu of %zu bytes in %zu blocks (high water %zu)\n",
+    ms.count(), arena.GetUsed(), arena.GetCapacity(), arena.GetNumBlocks(), arena.GetHighWater());
+
   m_pAudio->BeginFrame();
   if (state != eMusicState::MAINMENU) {
     printf("musicchange\n");
@@ -882,7 +939,7 @@ void CGame::Restart() {
 void CGame::PlayTitleSequence() {
     printf("PlayTitleSequence()\n");
     m_bTitleSequence = true;
-    m_pObjectManager->create(eSprite::Titlecard, Vec3toVec2(m_pRenderer->GetCameraPos()));
+    m_pObjectManager->create(eSprite::Titlecard, Vector2(m_nWinWidth / 2.0f, m_nWinHeight / 2.0f));
 }
 
 /// Poll the keyboard state and respond to the key presses that happened since
@@ -933,37 +990,37 @@ void CGame::KeyboardHandler() {
   }
 
   if (!m_bInMenu && !m_bGameOverScreen && !m_bAtEndScreen && !m_bTitleSequence) { // if the player isn't in the main menu
-      if (m_pPlayer) { //Safety
-        if (m_pKeyboard->TriggerDown(VK_CAPITAL) && m_pPlayer->m_bIsAttacking == false && m_pPlayer->GetHealth() > 0) { //checks to see if player is alive and isn't attacking (no fast attacking)
-          if (m_pPlayer->GetMana() > 0) { // Checks to see if player has mana
-            m_pPlayer->AttackTrigger();   // Triggers player sword swing
-            m_pObjectManager->FireGun(m_pPlayer, eSprite::Bullet);
-            m_pPlayer->SetMana(-1);       // reduce player mana by 1
-            m_pPlayer->SetFacingVectorAtShot(m_pPlayer->GetFacingVectorRad());  // Orients the explosion correctly
+      if (m_hPlayer) { //Safety
+        if (m_pKeyboard->TriggerDown(VK_CAPITAL) && m_hPlayer->m_bIsAttacking == false && m_hPlayer->GetHealth() > 0) { //checks to see if player is alive and isn't attacking (no fast attacking)
+          if (m_hPlayer->GetMana() > 0) { // Checks to see if player has mana
+            m_hPlayer->AttackTrigger();   // Triggers player sword swing
+            m_pObjectManager->FireGun(m_hPlayer.Get(), eSprite::Bullet);
+            m_hPlayer->SetMana(-1);       // reduce player mana by 1
+            m_hPlayer->SetFacingVectorAtShot(m_hPlayer->GetFacingVectorRad());  // Orients the explosion correctly
           }
         }
         if (m_pKeyboard->TriggerDown(VK_ESCAPE)) {
           Pause();
         }
-        if (m_pKeyboard->TriggerDown(VK_SPACE) && m_pPlayer->m_bIsAttacking == false && m_pPlayer->GetHealth() > 0) { //checks for player alive and isn't mid attack (no fast attacking)
-          m_pPlayer->AttackTrigger(); // Triggers player sword swing
-          m_pObjectManager->SwingSword(m_pPlayer, eSprite::TestSwing);
+        if (m_pKeyboard->TriggerDown(VK_SPACE) && m_hPlayer->m_bIsAttacking == false && m_hPlayer->GetHealth() > 0) { //checks for player alive and isn't mid attack (no fast attacking)
+          m_hPlayer->AttackTrigger(); // Triggers player sword swing
+          m_pObjectManager->SwingSword(m_hPlayer.Get(), eSprite::TestSwing);
         }
         if (m_pKeyboard->Down('W') && !m_pKeyboard->Down('S')) //strafe up
-          m_pPlayer->StrafeUp();
+          m_hPlayer->StrafeUp();
 
         if (m_pKeyboard->Down('D') && !m_pKeyboard->Down('A'))//strafe right
-          m_pPlayer->StrafeRight();
+          m_hPlayer->StrafeRight();
 
         if (m_pKeyboard->Down('A') && !m_pKeyboard->Down('D')) //strafe left
-          m_pPlayer->StrafeLeft();
+          m_hPlayer->StrafeLeft();
 
         if (m_pKeyboard->Down('S') && !m_pKeyboard->Down('W')) //strafe down
-          m_pPlayer->StrafeDown();
+          m_hPlayer->StrafeDown();
 
-        if (m_pKeyboard->TriggerDown(VK_SHIFT) && m_pPlayer->m_bIsDashing == false && m_pPlayer->GetStamina() > 0) { //Checks to see if player has stamina and isn't mid dash (no fast dashing)
-          m_pPlayer->DashTrigger(); // Triggers dash
-          m_pPlayer->SetStamina(-1);// reduce player stamina by 1
+        if (m_pKeyboard->TriggerDown(VK_SHIFT) && m_hPlayer->m_bIsDashing == false && m_hPlayer->GetStamina() > 0) { //Checks to see if player has stamina and isn't mid dash (no fast dashing)
+          m_hPlayer->DashTrigger(); // Triggers dash
+          m_hPlayer->SetStamina(-1);// reduce player stamina by 1
         }
         if (m_pKeyboard->Down('E')) //interact with things
             m_bInteract = true;
@@ -972,28 +1029,28 @@ void CGame::KeyboardHandler() {
       } //if
   } else if (!m_bTitleSequence && m_bInMenu) {
       if (m_pKeyboard->TriggerDown('S') || m_pKeyboard->TriggerDown(VK_DOWN)) {
-          m_pExitButton->Highlight();
-          m_pStartButton->Normal();
+          m_hExitButton->Highlight();
+          m_hStartButton->Normal();
       }
       if (m_pKeyboard->TriggerDown('W') || m_pKeyboard->TriggerDown(VK_UP)) {
-          m_pExitButton->Normal();
-          m_pStartButton->Highlight();
+          m_hExitButton->Normal();
+          m_hStartButton->Highlight();
       }
       if (m_pKeyboard->TriggerDown(VK_RETURN)) {
-          if (m_pExitButton->m_bIsSelected) {
-              m_pExitButton->Select();
+          if (m_hExitButton->m_bIsSelected) {
+              m_hExitButton->Select();
           }
-          else if (m_pStartButton->m_bIsSelected) {
+          else if (m_hStartButton->m_bIsSelected) {
               m_eGameState = eGameState::Playing; 
-              m_bInMenu = !m_pStartButton->Select();
+              m_bInMenu = !m_hStartButton->Select();
               BeginGame();
           }
       }
       if (m_pKeyboard->TriggerDown(VK_ESCAPE)) {
           if (m_bMainMenu) {
-              m_pStartButton->Highlight();
-              m_bInMenu = !m_pStartButton->Select();
-              m_bMainMenu = !m_pStartButton->Select();
+              m_hStartButton->Highlight();
+              m_bInMenu = !m_hStartButton->Select();
+              m_bMainMenu = !m_hStartButton->Select();
               m_eGameState = eGameState::Playing;
               BeginGame();
           }
@@ -1007,12 +1064,50 @@ void CGame::KeyboardHandler() {
 
 /// Draw the current frame rate to a hard-coded position in the window.
 /// The frame rate will be drawn in a hard-coded position using the font
-/// specified in `gamesettings.xml`.
+/// specified in `gamesettings.xml`. The number of broad phase pair tests
+/// and pairs skipped by collision mask in the last frame is drawn underneath it,
+/// followed by the number of bullets, swings and explosions taken from the
+/// object pools and the number that overflowed onto the heap, and the CPU
+/// time taken to draw the tiles with the tile render chunk hits and misses,
+/// the number of particles with the time taken to step them and the numbers
+/// drawn and culled at creation, and the particle budget utilisation with
+/// the numbers of particles admitted, thinned out and rejected in the last
+/// frame.
 
 void CGame::DrawFrameRateText() {
   const std::string s = std::to_string(m_pTimer->GetFPS()) + " fps"; //frame rate
   const Vector2 pos(m_nWinWidth - 128.0f, 30.0f); //hard-coded position
   m_pRenderer->DrawScreenText(s.c_str(), pos); //draw to screen
+
+  const std::string s2 = std::to_string(m_pObjectManager->GetPairTests()) + " pairs, " +
+    std::to_string(m_pObjectManager->GetPairsSkipped()) + " skipped"; //pair tests
+  const Vector2 pos2(m_nWinWidth - 320.0f, 60.0f); //hard-coded position
+  m_pRenderer->DrawScreenText(s2.c_str(), pos2); //draw to screen
+
+  const std::string s3 = std::to_string(m_pObjectManager->GetPooledAllocs()) + " pooled, " +
+    std::to_string(m_pObjectManager->GetHeapAllocs()) + " heap"; //pool allocations
+  const Vector2 pos3(m_nWinWidth - 320.0f, 90.0f); //hard-coded position
+  m_pRenderer->DrawScreenText(s3.c_str(), pos3); //draw to screen
+
+  const std::string s4 = std::to_string(m_pTileManager->GetDrawTime()) + " ms tiles, " +
+    std::to_string(m_pTileManager->GetChunkHits()) + "/" +
+    std::to_string(m_pTileManager->GetChunkMisses()) + " hit/miss"; //tile draw time and chunks
+  const Vector2 pos4(m_nWinWidth - 320.0f, 120.0f); //hard-coded position
+  m_pRenderer->DrawScreenText(s4.c_str(), pos4); //draw to screen
+
+  const std::string s5 = std::to_string(m_pParticleStore->GetSize()) + " particles, " +
+    std::to_string(m_pParticleStore->GetStepTime()) + " ms, " +
+    std::to_string(m_pParticleStore->GetNumDrawn()) + " drawn, " +
+    std::to_string(m_pParticleStore->GetNumCulled()) + " culled"; //particle count, step time, draw and cull counts
+  const Vector2 pos5(m_nWinWidth - 320.0f, 150.0f); //hard-coded position
+  m_pRenderer->DrawScreenText(s5.c_str(), pos5); //draw to screen
+
+  const CParticleBudget& budget = m_pParticleStore->GetBudget(); //particle budget
+  const std::string s6 = std::to_string((int)round(100.0f*budget.GetUtilisation())) + "% budget, " +
+    std::to_string(budget.GetAdmitted()) + "/" + std::to_string(budget.GetThinned()) + "/" +
+    std::to_string(budget.GetRejected()) + " in/thin/out"; //budget utilisation and admission
+  const Vector2 pos6(m_nWinWidth - 320.0f, 180.0f); //hard-coded position
+  m_pRenderer->DrawScreenText(s6.c_str(), pos6); //draw to screen
 } //DrawFrameRateText
 
 void CGame::DrawGodModeText() {
@@ -1029,7 +1124,8 @@ void CGame::RenderFrame() {
 
   //m_pRenderer->Draw(eSprite::Background, m_vWorldSize / 2.0f); //draw background
   m_pObjectManager->draw(); //draw objects 
-  m_pParticleEngine->Draw(); //draw particles
+  m_pParticleStore->Draw(); //draw visible particles
+  m_pObjectManager->DrawOverlay(); //draw HUD, menus and screens over the world
   if (m_bDrawFrameRate)DrawFrameRateText(); //draw frame rate, if required
   if (m_bGodMode)DrawGodModeText(); //draw god mode text, if required
 
@@ -1045,8 +1141,8 @@ void CGame::RenderFrame() {
 
 void CGame::FollowCamera() {
     if (!m_bInMenu) {
-        if (m_pPlayer == nullptr)return; //safety
-        Vector3 vCameraPos(m_pPlayer->GetPos()); //player position
+        if (!m_hPlayer)return; //safety
+        Vector3 vCameraPos(m_hPlayer->GetPos()); //player position
 
         if (m_vWorldSize.x > m_nWinWidth) { //world wider than screen
             vCameraPos.x = std::max(vCameraPos.x, m_nWinWidth / 2.0f); //stay away from the left edge
@@ -1060,10 +1156,6 @@ void CGame::FollowCamera() {
         } //if
         else vCameraPos.y = m_vWorldSize.y / 2.0f; //center vertically
 
-        m_pHealthBar->m_vPos = Vector2(vCameraPos.x - (m_nWinWidth / 2.0f) + 125.0f, vCameraPos.y - (m_nWinHeight / 2.0f) + 75.0f);
-        m_pManaBar->m_vPos = Vector2(vCameraPos.x + (m_nWinWidth / 2.0f) - 125.0f, vCameraPos.y - (m_nWinHeight / 2.0f) + 75.0f);
-        //m_pStaminaWheel->m_vPos = Vector2(vCameraPos.x + (m_nWinWidth / 2.0f) - 50.0f, vCameraPos.y - (m_nWinHeight / 2.0f) + 135.0f); // Above Mana Bar
-        m_pStaminaWheel->m_vPos = Vector2(vCameraPos.x, vCameraPos.y - (m_nWinHeight / 2.0f) + 65.0f); // Centered
 
         m_pRenderer->SetCameraPos(vCameraPos); //camera to player
     }
@@ -1075,55 +1167,55 @@ void CGame::FollowCamera() {
 /// </summary>
 
 void CGame::UI() {
-  if (m_pPlayer) { // Safety
-    if (m_pPlayer->GetHealth() > 5) 
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBarFull;
-    else if (m_pPlayer->GetHealth() == 5)
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar5;
-    else if (m_pPlayer->GetHealth() == 4)
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar4;
-    else if (m_pPlayer->GetHealth() == 3)
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar3;
-    else if (m_pPlayer->GetHealth() == 2)
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar2;
-    else if (m_pPlayer->GetHealth() == 1)
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar1;
-    else if (m_pPlayer->GetHealth() == 0)
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBarEmpty;
+  if (m_hPlayer) { // Safety
+    if (m_hPlayer->GetHealth() > 5) 
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBarFull;
+    else if (m_hPlayer->GetHealth() == 5)
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar5;
+    else if (m_hPlayer->GetHealth() == 4)
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar4;
+    else if (m_hPlayer->GetHealth() == 3)
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar3;
+    else if (m_hPlayer->GetHealth() == 2)
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar2;
+    else if (m_hPlayer->GetHealth() == 1)
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBar1;
+    else if (m_hPlayer->GetHealth() == 0)
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBarEmpty;
     else
-      m_pHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBarEmpty;
+      m_hHealthBar->m_nSpriteIndex = (UINT)eSprite::HealthBarEmpty;
   }
 
-  if (m_pPlayer) { // Safety
-    if (m_pPlayer->GetMana() > 5)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBarFull;
-    else if (m_pPlayer->GetMana() == 5)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar5;
-    else if (m_pPlayer->GetMana() == 4)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar4;
-    else if (m_pPlayer->GetMana() == 3)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar3;
-    else if (m_pPlayer->GetMana() == 2)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar2;
-    else if (m_pPlayer->GetMana() == 1)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar1;
-    else if (m_pPlayer->GetMana() == 0)
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBarEmpty;
+  if (m_hPlayer) { // Safety
+    if (m_hPlayer->GetMana() > 5)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBarFull;
+    else if (m_hPlayer->GetMana() == 5)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar5;
+    else if (m_hPlayer->GetMana() == 4)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar4;
+    else if (m_hPlayer->GetMana() == 3)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar3;
+    else if (m_hPlayer->GetMana() == 2)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar2;
+    else if (m_hPlayer->GetMana() == 1)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBar1;
+    else if (m_hPlayer->GetMana() == 0)
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBarEmpty;
     else
-      m_pManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBarEmpty;
+      m_hManaBar->m_nSpriteIndex = (UINT)eSprite::ManaBarEmpty;
   }
 
-  if (m_pPlayer) { // Safety
-    if (m_pPlayer->GetStamina() >= 3)
-      m_pStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheelFull;
-    else if (m_pPlayer->GetStamina() == 2)
-      m_pStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheel2;
-    else if (m_pPlayer->GetStamina() == 1)
-      m_pStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheel1;
-    else if (m_pPlayer->GetStamina() == 0)
-      m_pStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheelEmpty;
+  if (m_hPlayer) { // Safety
+    if (m_hPlayer->GetStamina() >= 3)
+      m_hStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheelFull;
+    else if (m_hPlayer->GetStamina() == 2)
+      m_hStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheel2;
+    else if (m_hPlayer->GetStamina() == 1)
+      m_hStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheel1;
+    else if (m_hPlayer->GetStamina() == 0)
+      m_hStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheelEmpty;
     else
-      m_pStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheelEmpty;
+      m_hStaminaWheel->m_nSpriteIndex = (UINT)eSprite::StaminaWheelEmpty;
   }
 }
 
@@ -1189,26 +1281,17 @@ void CGame::ProcessFrame() {
       m_pTimer->Tick([&]() { //all time-dependent function calls should go here
           m_pObjectManager->move(); //move all objects
           
-          if (m_pPlayer) {
+          if (m_hPlayer) {
               
-              if (!m_pPlayer->m_bIsTakingDamage)
+              if (!m_hPlayer->m_bIsTakingDamage)
                   FollowCamera(); //make camera follow player
           }
           else
               FollowCamera(); //make camera follow player
           
-          // if there are any particles waiting in min heap, check the trigger time.
-          // Create particle and remove CTimedSpawn object from min heap if trigger
-          if (!m_pTimedEvents.empty()) {
-              /*DEBUG printf("%f\n%f\n%f\n%f\n\n", m_pTimer->GetTime(), (float)(m_pTimedEvents.top().GetTime()), m_pTimedEvents.top().GetPart().m_vPos.x,
-                  m_pTimedEvents.top().GetPart().m_vPos.y);*/ 
-              while (!m_pTimedEvents.empty() && (m_pTimer->GetTime()) >= (m_pTimedEvents.top().GetTime())) {    //TODO? optimize 
-                  m_pParticleEngine->create(m_pTimedEvents.top().GetPart());
-                  m_pTimedEvents.pop();
-              }
-          }
+          FireTimedEvents(); //particles, spawns and sounds scheduled for now
 
-          m_pParticleEngine->step(); //advance particle animation
+          m_pParticleStore->step(m_pTimer->GetFrameTime()); //advance particle animation
           });
   }
   else {
@@ -1227,12 +1310,12 @@ void CGame::ProcessGameState() {
 
   switch (m_eGameState) {
   case eGameState::Playing:
-    if (m_pPlayer == nullptr) {
+    if (!m_hPlayer) {
       m_eGameState = eGameState::Waiting; //now waiting
       t = m_pTimer->GetTime(); //start wait timer
-    } else if (m_pPlayer->GetPort() != 0) {
+    } else if (m_hPlayer->GetPort() != 0) {
         /*if (!m_bInMenu) {
-            m_pObjectManager->create(eSprite::FadeOut, Vector2(m_pRenderer->GetCameraPos().x, m_pRenderer->GetCameraPos().y));
+            m_pObjectManager->create(eSprite::FadeOut, Vector2(m_nWinWidth / 2.0f, m_nWinHeight / 2.0f));
             m_bInMenu = true;
         }
         if (m_pObjectManager->GetFadeOut()) {
@@ -1242,13 +1325,13 @@ void CGame::ProcessGameState() {
                 printf("Done animating FadeOut\n");
                 m_bInMenu = false;
                 m_eGameState == eGameState::Waiting;
-                Goto(m_pPlayer->GetPort());
+                Goto(m_hPlayer->GetPort());
                 t = m_pTimer->GetTime();
             }
         }*/
         m_bInMenu = false;
         m_eGameState == eGameState::Waiting;
-        Goto(m_pPlayer->GetPort());
+        Goto(m_hPlayer->GetPort());
         t = m_pTimer->GetTime();
     }
     else if (m_pObjectManager->GetEnemyCount() == 0) {
@@ -1262,7 +1345,7 @@ void CGame::ProcessGameState() {
     }
     else {
         if (!m_bInMenu && !m_bFadeInAnimated) {
-            m_pObjectManager->create(eSprite::FadeIn, Vec3toVec2(m_pRenderer->GetCameraPos()));
+            m_pObjectManager->create(eSprite::FadeIn, Vector2(m_nWinWidth / 2.0f, m_nWinHeight / 2.0f));
             m_bInMenu = true;
         }
         if (m_pObjectManager->GetFadeIn()) {
@@ -58,6 +58,7 @@ class CGame:
     void DrawFrameRateText(); ///< Draw frame rate text to screen.
     void DrawGodModeText(); ///< Draw god mode text if in god mode.
     void CreateObjects(); ///< Create game objects.
+    void FireTimedEvents(); ///< Fire the timed events that are due.
     void FollowCamera(); ///< Make camera follow player character.
     void ProcessGameState(); ///< Process game state.
     void SpawnMany(eSprite type, std::vector<Vector2> positions); ///< Spawn any amount of the type at given positions
@@ -69,10 +70,14 @@ class CGame:
     //int ShakeTimer(); ///< Timer
 
     eMusicState state{ eMusicState::NONE};
+    std::vector<STimedEvent> m_vecDueEvents; ///< Timed events due this tick.
+    UINT64 m_nSeed = 0; ///< Random seed given on the command line.
+    bool m_bSeedGiven = false; ///< Whether a random seed was given.
 
   public:
     ~CGame(); ///< Destructor.
     void Goto(int); ///< Goto the level at the index;
+    void SetSeed(UINT64); ///< Set the random seed.
     void Initialize(); ///< Initialize the game.
     void Pause(); ///< Pause the game.
     void ProcessFrame(); ///< Process an animation frame.
@@ -71,6 +71,15 @@ enum class eSound : UINT {
   Size  //MUST BE LAST
 }; //eSound
 
+/// \brief Particle category enumerated type.
+///
+/// An enumerated type for what a particle is for, which decides how much of
+/// the particle budget it may use. `Size` must be last.
+
+enum class eParticleCategory : UINT {
+  Combat, Trail, Ambience,
+  Size  //MUST BE LAST
+}; //eParticleCategory
 
 /// \brief Game state enumerated type.
 ///
@@ -3,7 +3,7 @@
 #include "ComponentIncludes.h"
 #include "Player.h"
 #include "Particle.h"
-#include "ParticleEngine.h"
+#include "ParticleStore.h"
 #include "ObjectManager.h"
 #include "Helpers.h"
 
@@ -28,7 +28,7 @@ void KingSlime::CollisionResponse(const Vector2& norm, float d, CObject* pObj) {
 				Vector2 temp;
 				for (int i = 0; i < m_nDeathSpawnAmt; i++) {
 					splitfx();
-					temp = GenRandomPosition(0.6);
+					temp = GenRandomPosition(0.6f, m_cAIRandom);
 					temp.y -= 96.0f;
 					m_pObjectManager->create(eSprite::SlimeBig, temp);
 				}
@@ -54,7 +54,7 @@ void KingSlime::CollisionResponse(const Vector2& norm, float d, CObject* pObj) {
 
 void KingSlime::HopTowardsPlayer() {
 	Vector2 temp;
-	if (!m_pPlayer)
+	if (!m_hPlayer)
 		return;
 	printf("Hopping towards player\n");
 	state = eSlimeState::HOP;
@@ -62,16 +62,16 @@ void KingSlime::HopTowardsPlayer() {
 		m_nSpriteIndex = (UINT)eSprite::KingHop;
 	}
 	m_nCurrentFrame = 0;
-	m_vVelocity.x = m_pPlayer->GetPos().x - m_vPos.x;
-	m_vVelocity.y = m_pPlayer->GetPos().y - m_vPos.y;
+	m_vVelocity.x = m_hPlayer->GetPos().x - m_vPos.x;
+	m_vVelocity.y = m_hPlayer->GetPos().y - m_vPos.y;
 	m_vVelocity.Normalize();
 	m_vVelocity *= 70.0f;
 	if (m_nHealth <= 5)
 		m_vVelocity *= 2.0f;
-	if (m_pRandom->randf() < m_fSpawnChance) {
+	if (m_cAIRandom.randf() < m_fSpawnChance) {
 		for (int i = 0; i < m_nHopSpawnAmt; i++) {
 			splitfx();
-			temp = GenRandomPosition(0.6);
+			temp = GenRandomPosition(0.6f, m_cAIRandom);
 			temp.y -= 96.0f;
 			m_pObjectManager->create(eSprite::SlimeBig, temp);
 		}
@@ -94,8 +94,8 @@ void KingSlime::HopRandomly() {
 	m_vVelocity.y = 34.0f;
 	if (m_nHealth <= 5)
 		m_vVelocity *= 2.0f;
-	if (m_pRandom->randn(0, 1) == 1) {
-		m_vVelocity = RotateVector(m_vVelocity, m_pRandom->randf() * 5.0f);
+	if (m_cAIRandom.randn(0, 1) == 1) {
+		m_vVelocity = RotateVector(m_vVelocity, m_cAIRandom.randf() * 5.0f);
 	}
 }
 
@@ -107,7 +107,7 @@ void KingSlime::HopRandomly() {
 void KingSlime::UpdateFrame(){
 	const UINT n_frames = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex);
 
-	if (n_frames > 1 && m_pFrameEvent && m_pFrameEvent->Triggered()) {
+	if (n_frames > 1 && m_cFrameEvent.Triggered()) {
 		if ((m_nCurrentFrame + 1) >= n_frames) {
 			HandleFrameLoop(n_frames);
 		}
@@ -133,26 +133,26 @@ void KingSlime::UpdateFrame(){
 /// </summary>
 
 void KingSlime::splitfx() {
-	const int count = m_pRandom->randn(6, 12);
+	const int count = m_cEffectsRandom.randn(6, 12);
 	UINT randSpeed, randSize;
 	float x, y;
 	LParticleDesc2D m_part, e_part;
 	for (int i = 0; i < count; i++) {
 		m_part.m_nSpriteIndex = (UINT)eSprite::SlimeParticles;
-		m_part.m_nCurrentFrame = m_pRandom->randn(0, 8);
+		m_part.m_nCurrentFrame = m_cEffectsRandom.randn(0, 8);
 
 		m_part.m_f4Tint = m_f4Tint;
 
 		m_part.m_fFadeOutFrac = 0.05f;
 		m_part.m_fFadeInFrac = 0.4f;
 
-		m_part.m_vPos = GenRandomPosition(0.05f);
+		m_part.m_vPos = GenRandomPosition(0.05f, m_cEffectsRandom);
 		m_part.m_vPos.y -= m_fRadius * 0.75f;
 
-		m_part.m_vVel = m_pRandom->randv();
+		m_part.m_vVel = m_cEffectsRandom.randv();
 
-		randSpeed = m_pRandom->randn(60, 300);
-		randSize = m_pRandom->randn(6, 14);
+		randSpeed = m_cEffectsRandom.randn(60, 300);
+		randSize = m_cEffectsRandom.randn(6, 14);
 
 		m_part.m_vVel.x *= randSpeed;
 		m_part.m_vVel.y *= randSpeed;
@@ -173,8 +173,8 @@ void KingSlime::splitfx() {
 		e_part.m_fLifeSpan = 3.5f;
 		e_part.m_fFadeInFrac = 0.00f;
 		e_part.m_fFadeOutFrac = 0.95f;
-		m_pTimedEvents.emplace(CTimedSpawn::CTimedSpawn(m_pTimer->GetTime() + m_part.m_fLifeSpan - 0.05f, e_part));
-		m_pParticleEngine->create(m_part);
+		m_cTimedEvents.Schedule(m_part.m_fLifeSpan - 0.05f, e_part, eParticleCategory::Combat);
+		m_pParticleStore->create(m_part, eParticleCategory::Combat);
 	}
 }
 
@@ -222,7 +222,7 @@ void KingSlime::HandleFrameLoop(size_t n) {
 		m_bDead = true;
 
 		for (int i = 0; i < m_nDeathSpawnAmt; i++) {
-			temp = GenRandomPosition(0.6);
+			temp = GenRandomPosition(0.6f, m_cAIRandom);
 			temp.y -= 96.0f;
 			m_pObjectManager->create(eSprite::SlimeBig, temp);
 		}
@@ -238,9 +238,9 @@ void KingSlime::HandleFrameLoop(size_t n) {
 
 float KingSlime::DistanceToPlayer()
 {
-	if (m_pPlayer) {
-		printf("Distance to player: %f\n", (m_vPos - m_pPlayer->GetPos()).Length());
-		return (m_vPos - m_pPlayer->GetPos()).Length();
+	if (m_hPlayer) {
+		printf("Distance to player: %f\n", (m_vPos - m_hPlayer->GetPos()).Length());
+		return (m_vPos - m_hPlayer->GetPos()).Length();
 	}
 	else {
 		return 0.0f;
@@ -257,8 +257,8 @@ KingSlime::KingSlime(const Vector2& pos) : CObject(eSprite::KingIdle, pos) {
 	//m_fRadius *= 1.8;
 	m_fXScale = m_fYScale = 4.0f;
 	m_fRadius *= 0.8f;
-	m_pFrameEvent = new LEventTimer(0.2f);
-	m_pHopEvent = new LEventTimer(1.2f);
+	m_cFrameEvent.Start(0.2f);
+	m_cHopEvent.Start(1.2f);
 	m_bIsTarget = true;
 	m_bStatic = false;
 	m_nMaxHealth = 10;
@@ -270,8 +270,6 @@ KingSlime::KingSlime(const Vector2& pos) : CObject(eSprite::KingIdle, pos) {
 }
 
 KingSlime::~KingSlime() {
-	delete m_pFrameEvent;
-	delete m_pHopEvent;
 }
 
 void KingSlime::idle() {
@@ -282,15 +280,15 @@ void KingSlime::idle() {
 	m_nCurrentFrame = 0;
 	m_vVelocity = Vector2(5.0f, 5.0f);
 	m_bIsTarget = true;
-	m_pHopEvent->SetDelay((float)(5.0f * 0.8f));
+	m_cHopEvent.SetDelay((float)(5.0f * 0.8f));
 	if(m_nHealth <= 5)
-		m_pHopEvent->SetDelay((float)(3.5f * 0.8f));
+		m_cHopEvent.SetDelay((float)(3.5f * 0.8f));
 }
 
 void KingSlime::move() {
 	printf("Can be hit? %d\n", m_bIsTarget);
 	if (!m_bDead && !m_bStatic) {
-		if (state == eSlimeState::IDLE && m_pHopEvent && m_pHopEvent->Triggered()) {
+		if (state == eSlimeState::IDLE && m_cHopEvent.Triggered()) {
 			if (DistanceToPlayer() <= m_fEyesight) {
 				// the king can see the player
 				HopTowardsPlayer();
@@ -300,7 +298,6 @@ void KingSlime::move() {
 				HopRandomly();
 			}
 		}
-		UpdateFrame();
-		m_vPos += m_vVelocity * m_pTimer->GetFrameTime();
+		UpdateFrame(); //position is integrated by the object manager
 	}
 }
@@ -18,8 +18,8 @@ protected:
 	float m_fSpawnChance; /// Chance to spawn slimes on hop
 	float m_fEyesight; /// The range that the king slime can see
 
-	LEventTimer* m_pFrameEvent = nullptr;
-	LEventTimer* m_pHopEvent = nullptr;
+	CPeriodicTimer m_cFrameEvent;
+	CPeriodicTimer m_cHopEvent;
 
 	eSlimeState state{ eSlimeState::NONE };
 
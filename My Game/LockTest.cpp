@@ -16,13 +16,13 @@ void CLockTest::UnlockFx() {
 	if (CObject::m_nCurrentFrame == 0)
 		CObject::m_nCurrentFrame = 1;
 	m_pAudio->play(eSound::Acquire); //CHANGE OUT
-	CObject::objType = (UINT)eObjectType::UI;	//change type to not collide with player
+	m_pObjectManager->SetType(this, eObjectType::UI);	//change type to not collide with player
 } //UnlockFx
 
 void CLockTest::CollisionResponse(const Vector2& norm, float d, CObject* pObj) {
 	if (pObj && pObj->GetType() == (UINT)eObjectType::PLAYER) {
-		if (m_pPlayer->HasKey() && m_bInteract) {
-			m_pPlayer->UseKey();
+		if (m_hPlayer->HasKey() && m_bInteract) {
+			m_hPlayer->UseKey();
 			Unlock();
 		} //if
 	} //if
@@ -1,6 +1,8 @@
 /// \file Main.cpp 
 /// \brief Every program has to have a main.
 
+#include <cwchar>
+
 #include "Game.h"
 #include "Window.h"
 
@@ -18,7 +20,7 @@ static CGame g_cGame; ///< The game class.
 /// The main entry point for this application. 
 /// \param hInstance Handle to the current instance of this application.
 /// \param hPrevInstance Unused.
-/// \param lpCmdLine Unused.
+/// \param lpCmdLine Command line, which may give a random seed as `-seed n`.
 /// \param nCmdShow Nonzero if window is to be shown.
 /// \return 0 If this application terminates correctly, otherwise an error code.
 
@@ -26,7 +28,6 @@ int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
   _In_ LPWSTR lpCmdLine, _In_ int nCmdShow)
 {
   UNREFERENCED_PARAMETER(hPrevInstance);
-  UNREFERENCED_PARAMETER(lpCmdLine);
   UNREFERENCED_PARAMETER(nCmdShow);
   
   #ifdef USE_DEBUG_CONSOLE
@@ -35,6 +36,11 @@ int WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
     const bool console = false;
   #endif //USE_DEBUG_CONSOLE
 
+  const wchar_t* seed = wcsstr(lpCmdLine, L"-seed"); //random seed, if any
+
+  if(seed != nullptr)
+    g_cGame.SetSeed(wcstoull(seed + 5, nullptr, 10));
+
   auto init    = [&](){g_cGame.Initialize();};
   auto process = [&](){g_cGame.ProcessFrame();};
   auto release = [&](){g_cGame.Release();};
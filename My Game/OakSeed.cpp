@@ -3,11 +3,10 @@
 
 #include "OakSeed.h"
 #include "ComponentIncludes.h"
-#include "Particle.h"
-#include "ParticleEngine.h"
 #include "SimpleMath.h"
 #include "Helpers.h"
 #include "ObjectManager.h"
+#include "EmitterManager.h"
 #include "TileManager.h"
 #include "Player.h"
 
@@ -20,14 +19,15 @@ COakSeed::COakSeed(eSprite t, const Vector2& pos) : CObject(t, pos) {
 
   m_bIsTarget = true; //collides
   m_bStatic = false;  //not static
+  m_bIntegrate = false; //moves itself
 
   m_fRoll = 0.0f; //sprite rotation
   m_vVelocity = Vector2(0.0f, 0.0f); //still until starts walking
   m_fXScale = m_fYScale = 2.0f; //scale
   m_fRadius = 2.0f;
 
-  m_pIdleEvent = new LEventTimer(0.3f); //frame event timer for initial idle
-  m_pWanderEvent = new LEventTimer(2.0f, 1.0f); //frame event timer for wandering with delay
+  m_cIdleEvent.Start(0.3f); //frame event timer for initial idle
+  m_cWanderEvent.Start(2.0f, 1.0f); //frame event timer for wandering with delay
 
   state = eOakSeedState::IDLE; //initialize animation state to IDLE
 
@@ -35,26 +35,6 @@ COakSeed::COakSeed(eSprite t, const Vector2& pos) : CObject(t, pos) {
 
 /// Destructor. destory any event timers still up
 COakSeed::~COakSeed() {
-  if (m_pIdleEvent) {
-    delete m_pIdleEvent;
-    m_pIdleEvent = nullptr;
-  }
-  if (m_pWalkEvent) {
-    delete m_pWalkEvent;
-    m_pWalkEvent = nullptr;
-  }
-  if (m_pDeathEvent) {
-    delete m_pDeathEvent;
-    m_pDeathEvent = nullptr;
-  }
-  if (m_pDamageEvent) {
-    delete m_pDamageEvent;
-    m_pDamageEvent = nullptr;
-  }
-  if (m_pWanderEvent) {
-    delete m_pWanderEvent;
-    m_pWanderEvent = nullptr;
-  }
 } //destructor
 
 /// Cycle through the animation/action pipeline based on the circumstances of the OakSeed enemy
@@ -83,21 +63,15 @@ void COakSeed::move() {
 } //move
 
 
-/// Idle function for Oakseed. Sets the idleevent timer, deletes othere timers (for proper animation timing)
+/// Idle function for Oakseed. Sets the idleevent timer, stops other timers (for proper animation timing)
 /// then states animation state to idle. Animation direction is based on the direction the sprite is facing
 /// since it will try to face towards the player (a range is set for each)
 
 void COakSeed::Idle() {
-  if (!m_pIdleEvent) {
-    if (m_pWalkEvent) {
-      delete m_pWalkEvent;
-      m_pWalkEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pIdleEvent = new LEventTimer(0.3f);
+  if (!m_cIdleEvent.IsRunning()) {
+    m_cWalkEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cIdleEvent.Start(0.3f);
   }
   state = eOakSeedState::IDLE;
 
@@ -133,30 +107,24 @@ void COakSeed::Idle() {
 void COakSeed::Wander() {
   const float t = m_pTimer->GetTime(); //current time
 
-  if (m_pWanderEvent && m_pWanderEvent->Triggered()) { //enough time has passed
-    UINT multiplier = m_pRandom->randn(1, 16);
+  if (m_cWanderEvent.Triggered()) { //enough time has passed
+    UINT multiplier = m_cAIRandom.randn(1, 16);
     const float delta = (m_bStrayParity ? -1.3f : 1.3f) * 1.3f; //angle delta
 
     m_vVelocity = RotateVector(m_vVelocity, delta); //change direction by delta
     m_fFacingVector += delta; //rotate to face that direction
 
-    m_bStrayParity = m_pRandom->randf() < 0.5f; //next stray is randomly left or right
+    m_bStrayParity = m_cAIRandom.randf() < 0.5f; //next stray is randomly left or right
   }
 }
 
-/// Damage Trigger for Oakseed to delete other event timers, sent a damage event timer and set animation state to hurt
+/// Damage Trigger for Oakseed to stop other event timers, sent a damage event timer and set animation state to hurt
 
 void COakSeed::DamageTrigger() {
-  if (!m_pDamageEvent) {
-    if (m_pWalkEvent) {
-      delete m_pWalkEvent;
-      m_pWalkEvent = nullptr;
-    }
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    m_pDamageEvent = new LEventTimer(0.2f);
+  if (!m_cDamageEvent.IsRunning()) {
+    m_cWalkEvent.Stop();
+    m_cIdleEvent.Stop();
+    m_cDamageEvent.Start(0.2f);
   }
   state = eOakSeedState::HURT;
 }
@@ -204,23 +172,14 @@ void COakSeed::Damage() {
   m_vPos += m_vVelocity * t;
 }
 
-/// Death function to delete other event timers and set a death event timer. Also sets animation state to death and sprite animation to death
+/// Death function to stop other event timers and set a death event timer. Also sets animation state to death and sprite animation to death
 
 void COakSeed::Death() {
-  if (!m_pDeathEvent) {
-    if (m_pWalkEvent) {
-      delete m_pWalkEvent;
-      m_pWalkEvent = nullptr;
-    }
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pDeathEvent = new LEventTimer(0.12f);
+  if (!m_cDeathEvent.IsRunning()) {
+    m_cWalkEvent.Stop();
+    m_cIdleEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cDeathEvent.Start(0.12f);
   }
 
   if (state == eOakSeedState::DEATH) {
@@ -239,45 +198,8 @@ void COakSeed::Death() {
 /// colors them read and then gives them a random position. Eventually fade out
 
 void COakSeed::DeathFx() {
-  const int count = m_pRandom->randn(0, 10); //gen random num blood parts
-  UINT randColor, randSize; //random vars
-  LParticleDesc2D blood;
-  for (int i = 0; i < count; i++) {
-    blood.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-
-    //fade properties
-    blood.m_fFadeOutFrac = 0.8f;
-    blood.m_fFadeInFrac = 0.2f;
-    blood.m_fLifeSpan = 4.0f;
-
-    //get random position within the slime sprite
-    blood.m_vPos = GenRandomPosition(10.0f);
-
-    randColor = m_pRandom->randn(0, 2);    //random color 
-    randSize = m_pRandom->randn(0, 3);     //random size
-
-    //select random color
-    if (randColor == 0)
-      blood.m_f4Tint = XMFLOAT4(Colors::Black);
-    else if (randColor == 1)
-      blood.m_f4Tint = XMFLOAT4(Colors::DarkRed);
-    else
-      blood.m_f4Tint = XMFLOAT4(Colors::Red);
-
-    blood.m_f4Tint.w = 0.6f; //const alpha for all particles
-
-    //select random size
-    if (!randSize)
-      blood.m_fMaxScale = 0.2f;
-    else if (randSize == 1)
-      blood.m_fMaxScale = 0.25f;
-    else
-      blood.m_fMaxScale = 0.3f;
-
-    //spawn particle
-    m_pParticleEngine->create(blood);
-  }
-}
+  m_pEmitterManager->Emit(eEmitter::CritterDeath, SEmitterSource(m_vPos, m_fRadius));
+} //DeathFx
 
 /// Function that determines whether or not the player is detected, based on the position of the player
 /// the position of the enemy, and whether player is within an arbitrary circle around the enemy. The circle
@@ -285,8 +207,8 @@ void COakSeed::DeathFx() {
 /// rotateTowards() function to rotate towards the player. Otherwise, wanders randomly
 
 void COakSeed::FacePlayer() {
-  if (m_pPlayer) {
-    const float r = ((COakSeed*)m_pPlayer)->m_fRadius; //player radius
+  if (m_hPlayer) {
+    const float r = ((COakSeed*)m_hPlayer.Get())->m_fRadius; //player radius
     float dMin = 0.0f;
     if (m_bPlayerDetected) {
       dMin = 512.0f; //minimum distance at which target is invisible
@@ -296,14 +218,14 @@ void COakSeed::FacePlayer() {
     }
 
     const float dMinSq = dMin * dMin; //that squared
-    Vector2 pTarget = m_pPlayer->m_vPos;
+    Vector2 pTarget = m_hPlayer->m_vPos;
     Vector2 distance = pTarget - m_vPos;
     float mdistance = sqrt((distance.x * distance.x) + (distance.y * distance.y));
     float dsq = mdistance * mdistance; //distance squared to closest target
     //printf("min distance = %f  player distance = %f  ", dMinSq, dsq);
 
-    if (m_pTileManager->Visible(m_vPos, m_pPlayer->m_vPos, r) && dsq < dMinSq) { //player visible
-      RotateTowards(m_pPlayer->m_vPos, dsq); //rotate towards target
+    if (m_pTileManager->Visible(m_vPos, m_hPlayer->m_vPos, r) && dsq < dMinSq) { //player visible
+      RotateTowards(m_hPlayer->m_vPos, dsq); //rotate towards target
       m_bPlayerDetected = true;
     }
     else {
@@ -354,22 +276,16 @@ void COakSeed::RotateTowards(const Vector2& pos, float dsq) {
   }
 } //RotateTowards
 
-/// function to head towards player. Deletes any eventtimers that aren't walk and sets it if not already set
+/// function to head towards player. Stops any event timers that aren't walk and sets it if not already set
 /// then gives animation based on facing vector and walks at a set speed. Also used for wandering, so
 /// enemy walks twice as fast when playe detected.
 
 void COakSeed::MoveTowardsPlayer() {
-  if (!m_pWalkEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
+  if (!m_cWalkEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
 
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pWalkEvent = new LEventTimer(0.2f);
+    m_cDamageEvent.Stop();
+    m_cWalkEvent.Start(0.2f);
   }
 
   state = eOakSeedState::WALK;
@@ -419,31 +335,31 @@ void COakSeed::MoveTowardsPlayer() {
 void COakSeed::UpdateFramenumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
   if (state != eOakSeedState::DEATH) {
-    if (n > 1 && m_pIdleEvent && m_pIdleEvent->Triggered()) {
+    if (n > 1 && m_cIdleEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
       }
     }
-    else if (n > 1 && m_pDamageEvent && m_pDamageEvent->Triggered()) {
+    else if (n > 1 && m_cDamageEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bIsTarget = true;
         Idle();
       }
     }
-    else if (n > 1 && m_pWalkEvent && m_pWalkEvent->Triggered()) {
+    else if (n > 1 && m_cWalkEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
       }
     }
   }
-  else if (n > 1 && m_pDeathEvent && m_pDeathEvent->Triggered() && state == eOakSeedState::DEATH) {
+  else if (n > 1 && m_cDeathEvent.Triggered() && state == eOakSeedState::DEATH) {
     DeathFx();
     m_bDeadCheck = true;
     m_bStatic = true;
     m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     if (m_nCurrentFrame == n - 1) {
-      const UINT chance = m_pRandom->randn(1, 3);
+      const UINT chance = m_cAIRandom.randn(1, 3);
       if (chance == 1)
         m_pObjectManager->create(eSprite::HealthPotion, m_vPos);
       else if (chance == 2)
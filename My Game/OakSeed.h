@@ -18,11 +18,11 @@ protected:
   UINT m_nMaxHealth = 3; ///< Maximum health.
   UINT m_nHealth = m_nMaxHealth; ///< Current health.
 
-  LEventTimer* m_pIdleEvent = nullptr; ///< Idle event timer.
-  LEventTimer* m_pWalkEvent = nullptr; ///< Walk event timer
-  LEventTimer* m_pDamageEvent = nullptr; ///< Damage event timer
-  LEventTimer* m_pDeathEvent = nullptr; ///< Death Event timer
-  LEventTimer* m_pWanderEvent = nullptr; ///< Wander Event timer
+  CPeriodicTimer m_cIdleEvent; ///< Idle event timer.
+  CPeriodicTimer m_cWalkEvent; ///< Walk event timer
+  CPeriodicTimer m_cDamageEvent; ///< Damage event timer
+  CPeriodicTimer m_cDeathEvent; ///< Death Event timer
+  CPeriodicTimer m_cWanderEvent; ///< Wander Event timer
 
   bool m_bStrayParity = true; ///< Stray from path left or right.
   bool m_bPreferPosRot = false; ///< Prefer positive rotation.
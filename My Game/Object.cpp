@@ -16,25 +16,26 @@ CObject::CObject(eSprite t, const Vector2& p):
   LBaseObject(t, p)
 { 
   m_fRoll = XM_PIDIV2; //facing upwards
+  m_nBaseSprite = (UINT)t; //for the object manager's handles
   m_bIsTarget = false; //not a target
 
   const float w = m_pRenderer->GetWidth(t); //sprite width
   const float h = m_pRenderer->GetHeight(t); //sprite height
   m_fRadius = std::max(w, h) / 2; //bounding circle radius
 
-  m_pGunFireEvent = new LEventTimer(1.0f); //timer for firing gun
+  m_cGunFireEvent.Start(1.0f); //timer for firing gun
 } //constructor
 
 /// Destructor.
 CObject::~CObject(){
-  delete m_pGunFireEvent;
 } //destructor
 
-/// Move object an amount that depends on its velocity and the frame time.
+/// Move object. The object manager moves objects an amount that depends on
+/// their velocity and the frame time in one batch after calling `move()` on
+/// each of them, so there is nothing to do here. Objects that move themselves
+/// must clear `m_bIntegrate`.
 
 void CObject::move(){
-  if(!m_bDead && !m_bStatic)
-    m_vPos += m_vVelocity*m_pTimer->GetFrameTime();
 } //move
 
 /// Ask the renderer to draw the sprite described in the sprite descriptor.
@@ -100,13 +101,14 @@ const float CObject::GetFacingVectorRad() const {
 
 /// <summary> 
 /// Generates a random position within the callers radius.
-/// takes float as parameter, which can shrink or grow the position area
+/// takes float as parameter, which can shrink or grow the position area,
+/// and the random number stream to draw from
 /// </summary>
 /// <returns> Vector2 position </returns>
-const Vector2 CObject::GenRandomPosition(float radiusMultiplier) const {
+const Vector2 CObject::GenRandomPosition(float radiusMultiplier, CRandomStream& stream) const {
     UINT randMult; 
     Vector2 randomPosition;
-    randMult = m_pRandom->randn(0, 31); //gen random value
+    randMult = stream.randn(0, 31); //gen random value
     //generate random x offset on object
     if (randMult < 16)  //offset positive
         randomPosition.x = this->m_vPos.x + (this->m_fRadius * radiusMultiplier) * (float)randMult / (float)16;
@@ -114,7 +116,7 @@ const Vector2 CObject::GenRandomPosition(float radiusMultiplier) const {
         randomPosition.x = this->m_vPos.x - (this->m_fRadius * radiusMultiplier) * (float)randMult / (float)16;
     
     //generate random y offset on player
-    randMult = m_pRandom->randn(0, 31);
+    randMult = stream.randn(0, 31);
     if (randMult < 16)  //offset positive
         randomPosition.y = this->m_vPos.y + (this->m_fRadius * radiusMultiplier) * (float)randMult / (float)16;
     else                //offset negative
@@ -161,6 +163,14 @@ const bool CObject::isSlime() const {
     return (objType == (UINT)eObjectType::SLIME);
 } //isSlime
 
+/// Reader function for the handle that the object manager issued to this
+/// object when it was created.
+/// \return Generational handle.
+
+const SObjectHandle& CObject::GetHandle() const{
+  return m_hHandle;
+} //GetHandle
+
 const bool CObject::GetIsDead() const {
   return m_bDeadCheck;
 }
@@ -10,7 +10,8 @@
 #include "Component.h"
 #include "SpriteDesc.h"
 #include "BaseObject.h"
-#include "EventTimer.h"
+#include "PeriodicTimer.h"
+#include "PhysicsStore.h"
 
 /// \brief The game object. 
 ///
@@ -37,11 +38,18 @@ class CObject:
     bool m_bDeadCheck = false;
 
     UINT objType = 0;
+    UINT m_nBaseSprite = 0; ///< Sprite the object was constructed with.
+    UINT m_nLayer = 0; ///< Collision layer bit, one bit per object type.
+    UINT m_nCollisionMask = 0; ///< Collision layers that this object can interact with.
+    UINT m_nSlot = CPhysicsStore::NONE; ///< Slot in the object manager's physics store.
+    bool m_bIntegrate = true; ///< Position is integrated by the object manager, not by move().
+    bool m_bFixed = false; ///< Never moves, so is kept in the object manager's static grid.
+    SObjectHandle m_hHandle; ///< Handle issued by the object manager.
 
     float m_fFacingVector = 0.0f; ///< For new direction vector
 
-    LEventTimer* m_pGunFireEvent = nullptr; ///< Gun fire event.
-    LEventTimer* m_pSwordAttackEvent = nullptr; ///< Sword Attack event
+    CPeriodicTimer m_cGunFireEvent; ///< Gun fire event.
+    CPeriodicTimer m_cSwordAttackEvent; ///< Sword Attack event
     
     virtual void CollisionResponse(const Vector2&, float,
     CObject* = nullptr); ///< Collision response.
@@ -54,6 +62,7 @@ class CObject:
     void draw(); ///< Draw object.
 
     const UINT GetType() const; 
+    const SObjectHandle& GetHandle() const; ///< Get handle.
 
     const bool isBullet() const; ///< Is a bullet.
     const bool isSword() const; ///< Is a sword attack.
@@ -61,7 +70,7 @@ class CObject:
     const Vector2 GetViewVector() const; ///< Compute view vector.
     const Vector2 GetFacingVector() const; ///< Compute facing vector.
     const float GetFacingVectorRad() const; ///< Get facing vector in radians.
-    const Vector2 GenRandomPosition(float radiusMultiplier) const; ///< Returns random position Vector2 that lies within the callers radius
+    const Vector2 GenRandomPosition(float radiusMultiplier, CRandomStream& stream) const; ///< Returns random position Vector2 that lies within the callers radius
 
     const bool CObject::isPlayer() const;
     const bool CObject::isHealthPotion() const;
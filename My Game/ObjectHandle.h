@@ -0,0 +1,99 @@
+/// \file ObjectHandle.h
+/// \brief Interface and code for the object handles SObjectHandle and CHandle.
+
+#ifndef __L4RC_GAME_OBJECTHANDLE_H__
+#define __L4RC_GAME_OBJECTHANDLE_H__
+
+#include <cassert>
+
+#include "Defines.h"
+
+class CObject;
+
+/// \brief Generational object handle.
+///
+/// A reference to an object that doesn't depend on where the object is
+/// stored. The object manager issues one to each object it creates, made up
+/// of a slot in its handle table and the generation of that slot. When the
+/// object is deleted the slot's generation is incremented, so any handles to
+/// it resolve to null instead of dangling, even after the slot is reused.
+
+struct SObjectHandle{
+  static const UINT NONE = 0xFFFFFFFF; ///< Slot of the null handle.
+
+  UINT m_nSlot = NONE; ///< Slot in the object manager's handle table.
+  UINT m_nGeneration = 0; ///< Generation of the slot when the handle was issued.
+}; //SObjectHandle
+
+CObject* ResolveHandle(const SObjectHandle&); ///< Get the object a handle refers to.
+
+/// \brief Typed object handle.
+///
+/// A generational handle that behaves like a pointer to an object of a
+/// given type. Each access resolves the handle in constant time, giving null
+/// if the object has been deleted.
+/// \tparam T Object type, derived from `CObject`.
+
+template<class T> class CHandle{
+  private:
+    SObjectHandle m_hObject; ///< Generational handle.
+
+  public:
+    CHandle() = default; ///< Default constructor.
+    CHandle(T*); ///< Constructor.
+
+    CHandle& operator=(T*); ///< Refer to an object.
+    T* operator->() const; ///< Access the object.
+    explicit operator bool() const; ///< Whether the object still exists.
+
+    T* Get() const; ///< Get the object.
+    const SObjectHandle& GetHandle() const; ///< Get the untyped handle.
+}; //CHandle
+
+/// Construct a handle to an object.
+/// \param p Pointer to an object, or `nullptr` for the null handle.
+
+template<class T> CHandle<T>::CHandle(T* p){
+  *this = p;
+} //constructor
+
+/// Make the handle refer to an object.
+/// \param p Pointer to an object, or `nullptr` for the null handle.
+/// \return Reference to this handle.
+
+template<class T> CHandle<T>& CHandle<T>::operator=(T* p){
+  m_hObject = p == nullptr? SObjectHandle(): p->GetHandle();
+  return *this;
+} //operator=
+
+/// Access the object. It must still exist.
+/// \return Pointer to the object.
+
+template<class T> T* CHandle<T>::operator->() const{
+  T* p = Get();
+  assert(p != nullptr);
+  return p;
+} //operator->
+
+/// Determine whether the object still exists.
+/// \return true if the handle resolves to an object.
+
+template<class T> CHandle<T>::operator bool() const{
+  return ResolveHandle(m_hObject) != nullptr;
+} //operator bool
+
+/// Get the object that the handle refers to.
+/// \return Pointer to the object, or `nullptr` if it has been deleted.
+
+template<class T> T* CHandle<T>::Get() const{
+  return static_cast<T*>(ResolveHandle(m_hObject));
+} //Get
+
+/// Reader function for the untyped handle.
+/// \return The generational handle.
+
+template<class T> const SObjectHandle& CHandle<T>::GetHandle() const{
+  return m_hObject;
+} //GetHandle
+
+#endif //__L4RC_GAME_OBJECTHANDLE_H__
@@ -1,6 +1,9 @@
 /// \file ObjectManager.cpp
 /// \brief Code for the the object manager class CObjectManager.
 
+#include <cassert>
+#include <algorithm>
+
 #include "ObjectManager.h"
 #include "ComponentIncludes.h"
 
@@ -39,8 +42,137 @@
 #include "EndingScreen.h"
 
 
+/// Constructor.
+
+CObjectManager::CObjectManager() {
+  MakeInteractionMatrix();
+} //constructor
+
+/// Destructor. Pooled objects must go back to their pools before the pools
+/// are destroyed, so all of the objects are deleted here rather than being
+/// left for the base class destructor.
+
+CObjectManager::~CObjectManager() {
+  clear();
+} //destructor
+
+/// Determine whether objects created with a given sprite belong in the
+/// screen-space overlay rather than in the simulated object list.
+/// \param t Sprite type.
+/// \return true if the sprite is a HUD element, menu item or screen.
+
+const bool CObjectManager::IsOverlay(eSprite t) {
+  switch (t) {
+    case eSprite::HealthBarFull:
+    case eSprite::ManaBarFull:
+    case eSprite::StaminaWheelFull:
+    case eSprite::BG:
+    case eSprite::Exit:
+    case eSprite::Start:
+    case eSprite::FadeIn:
+    case eSprite::FadeOut:
+    case eSprite::GameOver:
+    case eSprite::EndingScreen:
+    case eSprite::Titlecard:
+      return true;
+
+    default: return false;
+  } //switch
+} //IsOverlay
+
+/// Determine whether the oldest object created with a given sprite is kept
+/// track of for the `Get` functions, such as `GetNextMap()`.
+/// \param t Sprite type.
+/// \return true if the sprite is a portal, a fade or the title card.
+
+const bool CObjectManager::HasHandle(eSprite t) {
+  switch (t) {
+    case eSprite::NextPortal:
+    case eSprite::PrevPortal:
+    case eSprite::FadeIn:
+    case eSprite::FadeOut:
+    case eSprite::Titlecard:
+      return true;
+
+    default: return false;
+  } //switch
+} //HasHandle
+
+/// Determine whether objects created with a given sprite never move, and so
+/// belong in the static grid rather than being binned every frame.
+/// \param t Sprite type.
+/// \return true if the sprite is a turret, spikes, potion, key or portal.
+
+const bool CObjectManager::IsFixed(eSprite t) {
+  switch (t) {
+    case eSprite::Turret:
+    case eSprite::Spikes:
+    case eSprite::HealthPotion:
+    case eSprite::ManaPotion:
+    case eSprite::Key:
+    case eSprite::NextPortal:
+    case eSprite::PrevPortal:
+      return true;
+
+    default: return false;
+  } //switch
+} //IsFixed
+
+/// Fill in the collision layer interaction matrix. Row `t` has a bit set for
+/// each object type whose collisions an object of type `t` does something
+/// about in its `CollisionResponse()`. Types that fall through to
+/// `CObject::CollisionResponse()` can be pushed by anything except UI and
+/// potions. The matrix is then made symmetric, since a pair needs to be
+/// tested if either object cares about the other.
+
+void CObjectManager::MakeInteractionMatrix() {
+  auto bit = [](eObjectType t) { return 1U << (UINT)t; }; //layer bit for a type
+
+  const UINT all = (1U << (UINT)eObjectType::Size) - 1; //every layer
+  const UINT solid = all & ~(bit(eObjectType::UI) |
+    bit(eObjectType::HEALTHPOT) | bit(eObjectType::MANAPOT)); //default collision response
+  const UINT weapons = bit(eObjectType::BULLET) | bit(eObjectType::SWORD); //things that hurt
+
+  UINT* m = m_nInteracts; //shorthand
+
+  m[(UINT)eObjectType::UNDEFINED] = solid;
+  m[(UINT)eObjectType::PLAYER]    = all & ~bit(eObjectType::UI);
+  m[(UINT)eObjectType::BULLET]    = bit(eObjectType::PLAYER) | bit(eObjectType::SLIME) |
+    bit(eObjectType::RABITE) | bit(eObjectType::OAKSEED) | bit(eObjectType::TURRET) |
+    bit(eObjectType::LOCKBLOCK) | bit(eObjectType::BULLET);
+  m[(UINT)eObjectType::SLIME]     = weapons;
+  m[(UINT)eObjectType::RABITE]    = weapons | bit(eObjectType::PLAYER);
+  m[(UINT)eObjectType::OAKSEED]   = weapons | bit(eObjectType::PLAYER);
+  m[(UINT)eObjectType::SWORD]     = solid;
+  m[(UINT)eObjectType::HEALTHPOT] = bit(eObjectType::PLAYER);
+  m[(UINT)eObjectType::TURRET]    = weapons;
+  m[(UINT)eObjectType::MANAPOT]   = bit(eObjectType::PLAYER);
+  m[(UINT)eObjectType::OBSTACLE]  = 0; //static
+  m[(UINT)eObjectType::UI]        = 0;
+  m[(UINT)eObjectType::LOCKBLOCK] = solid;
+  m[(UINT)eObjectType::EXPLOSION] = 0; //static
+
+  for (UINT i = 0; i < (UINT)eObjectType::Size; i++) //make symmetric
+    for (UINT j = 0; j < (UINT)eObjectType::Size; j++)
+      if (m[i] & (1U << j))
+        m[j] |= 1U << i;
+} //MakeInteractionMatrix
+
+/// Set an object's collision layer and collision mask from its object type.
+/// \param pObj Pointer to an object.
+
+void CObjectManager::SetLayer(CObject* pObj) {
+  pObj->m_nLayer = 1U << pObj->objType;
+  pObj->m_nCollisionMask = m_nInteracts[pObj->objType];
+} //SetLayer
+
 /// Create an object and put a pointer to it at the back of the object list
-/// `m_stdObjectList`, which it inherits from `LBaseObjectManager`.
+/// `m_vecObjects`. Overlay objects go at the back of `m_vecOverlay` instead, and their position
+/// is in screen space. Objects that never move go into the static grid if
+/// it has already been built for this level. Bullets, swings and explosions
+/// come from the object pools, and objects that live until the end of the
+/// level come from the level arena if the level is being loaded and from the
+/// heap otherwise. Every object is issued a handle.
 /// \param t Sprite type.
 /// \param pos Initial position.
 /// \return Pointer to the object created.
@@ -49,36 +181,36 @@ CObject* CObjectManager::create(eSprite t, const Vector2& pos) {
   CObject* pObj = nullptr;
 
   switch (t) { //create object of type t
-    case eSprite::Player:  pObj = new CPlayer(pos); break;
-    case eSprite::Turret:  pObj = new CTurret(eSprite::Turret, pos); break;
-    case eSprite::Bullet:  pObj = new CBullet(eSprite::Fireball, pos); break;
-    case eSprite::Explosion: pObj = new CExplosion(eSprite::Explosion, pos); break;
-    case eSprite::Explosion2: pObj = new CExplosion2(eSprite::Explosion2, pos); break;
-    case eSprite::Explosion3: pObj = new CExplosion3(eSprite::Explosion4, pos); break;
-    case eSprite::Bullet2: pObj = new CTurretBullet(eSprite::TurretFireball, pos); break;
-    case eSprite::Slime:   pObj = new CSlime(pos, 1); break;
-    case eSprite::SlimeBig:pObj = new CSlimeBig(pos, 3); break;
-    case eSprite::SlimeKing: pObj = new KingSlime(pos); break;
-    case eSprite::Rabite: pObj = new CRabite(eSprite::RabiteIdleDown, pos); break;
-    case eSprite::OakSeed: pObj = new COakSeed(eSprite::OakSeedIdleDown, pos); break;
-    case eSprite::HealthPotion:pObj = new CHealthPotion(pos); break;
-    case eSprite::ManaPotion:pObj = new CManaPotion(pos); break;
+    case eSprite::Player:  pObj = Make<CPlayer>(pos); break;
+    case eSprite::Turret:  pObj = Make<CTurret>(eSprite::Turret, pos); break;
+    case eSprite::Bullet:  pObj = m_cBulletPool.Alloc(eSprite::Fireball, pos); break;
+    case eSprite::Explosion: pObj = m_cExplosionPool.Alloc(eSprite::Explosion, pos); break;
+    case eSprite::Explosion2: pObj = m_cExplosion2Pool.Alloc(eSprite::Explosion2, pos); break;
+    case eSprite::Explosion3: pObj = m_cExplosion3Pool.Alloc(eSprite::Explosion4, pos); break;
+    case eSprite::Bullet2: pObj = m_cTurretBulletPool.Alloc(eSprite::TurretFireball, pos); break;
+    case eSprite::Slime:   pObj = Make<CSlime>(pos, 1); break;
+    case eSprite::SlimeBig:pObj = Make<CSlimeBig>(pos, 3); break;
+    case eSprite::SlimeKing: pObj = Make<KingSlime>(pos); break;
+    case eSprite::Rabite: pObj = Make<CRabite>(eSprite::RabiteIdleDown, pos); break;
+    case eSprite::OakSeed: pObj = Make<COakSeed>(eSprite::OakSeedIdleDown, pos); break;
+    case eSprite::HealthPotion:pObj = Make<CHealthPotion>(pos); break;
+    case eSprite::ManaPotion:pObj = Make<CManaPotion>(pos); break;
     case eSprite::Exit:pObj = new CMainMenuExit(pos); break;
     case eSprite::BG:pObj = new CMainMenuBG(pos); break;
     case eSprite::Start:pObj = new CMainMenuStart(pos); break;
-    case eSprite::Key:pObj = new CKey(pos); break;
-    case eSprite::LockTest:pObj = new CLockTest(pos, eSprite::LockTest); break;
-    case eSprite::Swing:pObj = new CSwordAttack(eSprite::Swing, pos); break;
-    case eSprite::TestSwing:pObj = new CSwordAttack(eSprite::Swing, pos); break;
-    case eSprite::NextPortal:pObj = new NextMapPorter(pos); break;
-    case eSprite::PrevPortal:pObj = new PrevMapPorter(pos); break;
+    case eSprite::Key:pObj = Make<CKey>(pos); break;
+    case eSprite::LockTest:pObj = Make<CLockTest>(pos, eSprite::LockTest); break;
+    case eSprite::Swing:pObj = m_cSwordPool.Alloc(eSprite::Swing, pos); break;
+    case eSprite::TestSwing:pObj = m_cSwordPool.Alloc(eSprite::Swing, pos); break;
+    case eSprite::NextPortal:pObj = Make<NextMapPorter>(pos); break;
+    case eSprite::PrevPortal:pObj = Make<PrevMapPorter>(pos); break;
     case eSprite::FadeIn: pObj = new FadeInObject(pos); break;
     case eSprite::FadeOut: pObj = new FadeOutObject(pos); break;
     case eSprite::GameOver: pObj = new GameOverObject(pos); break;
     case eSprite::EndingScreen: pObj = new EndingScreen(pos); break;
     case eSprite::Titlecard: pObj = new TitleCard(pos); break;
     case eSprite::Spikes: {
-        pObj = new Obstacle(pos, 0, eSprite::Spikes);
+        pObj = Make<Obstacle>(pos, 0, eSprite::Spikes);
         Obstacle* p = (Obstacle*)pObj;
         p->FixBoundingBox(0.02f);
     } break;
@@ -87,10 +219,303 @@ CObject* CObjectManager::create(eSprite t, const Vector2& pos) {
   default: pObj = new CObject(t, pos);
   } //switch
 
-  m_stdObjectList.push_back(pObj); //push pointer onto object list
+  if (IsOverlay(t))
+    m_vecOverlay.push_back(pObj); //push pointer onto overlay list
+
+  else {
+    m_vecObjects.push_back(pObj); //push pointer onto object list
+    pObj->m_nSlot = m_cPhysics.Alloc(pObj); //physics slot
+    pObj->m_bFixed = IsFixed(t);
+
+    if (pObj->m_bFixed && m_bStaticGrid)
+      AddStatic(pObj);
+  } //else
+
+  Register(pObj); //count it
+  IssueHandle(pObj);
   return pObj; //return pointer to created object
 } //create
 
+/// Add an object to the per-type counts and the per-sprite counts. If its
+/// sprite has a handle and it is the first live object constructed with that
+/// sprite, make it the handle so that the Get functions below don't need to
+/// search for it.
+/// \param pObj Pointer to an object.
+
+void CObjectManager::Register(CObject* pObj) {
+  SetLayer(pObj);
+  m_nTypeCount[pObj->objType]++;
+  m_nSpriteCount[pObj->m_nBaseSprite]++;
+
+  if (HasHandle((eSprite)pObj->m_nBaseSprite) && m_pHandle[pObj->m_nBaseSprite] == nullptr)
+    m_pHandle[pObj->m_nBaseSprite] = pObj;
+} //Register
+
+/// Remove an object from the per-type and per-sprite counts. If it was the
+/// handle for its sprite then the handle passes to the next oldest object
+/// constructed with the same sprite, if there is one. Only the few sprites
+/// that the Get functions use have handles, so this search is rare.
+/// \param pObj Pointer to an object.
+
+void CObjectManager::Unregister(CObject* pObj) {
+  const UINT n = pObj->m_nBaseSprite; //shorthand
+  m_nTypeCount[pObj->objType]--;
+  m_nSpriteCount[n]--;
+
+  if (pObj->m_bFixed && m_bStaticGrid)
+    RemoveStatic(pObj);
+
+  if (pObj->m_nSlot != CPhysicsStore::NONE) { //release physics slot
+    m_cPhysics.Free(pObj->m_nSlot);
+    pObj->m_nSlot = CPhysicsStore::NONE;
+  } //if
+
+  if (m_pHandle[n] == pObj) {
+    m_pHandle[n] = nullptr;
+
+    if (m_nSpriteCount[n] > 0) { //search the list that it was in for the next one
+      const std::vector<CObject*>& v = IsOverlay((eSprite)n)? m_vecOverlay: m_vecObjects;
+
+      for (CObject* p : v)
+        if (p != pObj && p->m_nBaseSprite == n) {
+          m_pHandle[n] = p;
+          break;
+        } //if
+    } //if
+  } //if
+} //Unregister
+
+/// Move all of the objects, then perform collision detection and response,
+/// then delete the dead objects. This replaces `LBaseObjectManager::move()`
+/// so that the counts are kept up to date when objects are culled. Each
+/// object's `move()` does its own AI and animation, then the positions of
+/// objects that don't move themselves are integrated in one pass over the
+/// physics store. Overlay objects are animated and culled but take no part
+/// in collisions. Objects may create new objects as they move, which can
+/// reallocate the lists, so they are walked by index rather than iterator.
+/// New objects are moved in the same frame.
+
+void CObjectManager::move() {
+  for (size_t i = 0; i < m_vecObjects.size(); i++) //for each object
+    m_vecObjects[i]->move(); //AI and animation
+
+  Gather(); //copy into physics store
+  m_cPhysics.Integrate(m_pTimer->GetFrameTime()); //move
+  Scatter(); //copy positions back
+
+  BroadPhase(); //collisions
+  CullDeadObjects(m_vecObjects); //delete dead objects
+
+  for (size_t i = 0; i < m_vecOverlay.size(); i++) //for each overlay object
+    m_vecOverlay[i]->move(); //animate it
+
+  CullDeadObjects(m_vecOverlay); //delete dead overlay objects
+
+#ifdef _DEBUG
+  CheckCounts();
+#endif //_DEBUG
+} //move
+
+/// Delete the dead objects from an object list, removing them from the
+/// counts first. The live objects are compacted towards the front in one
+/// pass, keeping their order so that the draw order and the oldest-object
+/// handles don't change, and the list is truncated. The dead objects are
+/// unregistered after that so that a handle never passes to an object that
+/// is about to be deleted.
+/// \param vecList Object list.
+
+void CObjectManager::CullDeadObjects(std::vector<CObject*>& vecList) {
+  size_t n = 0; //number of live objects
+
+  for (CObject* pObj : vecList) //for each object
+    if (pObj->m_bDead)
+      m_vecDead.push_back(pObj);
+
+    else vecList[n++] = pObj; //keep it
+
+  if (m_vecDead.empty())return; //nothing died
+
+  vecList.resize(n);
+
+  for (CObject* pObj : m_vecDead) { //delete the dead
+    Unregister(pObj);
+    Destroy(pObj);
+  } //for
+
+  m_vecDead.clear();
+} //CullDeadObjects
+
+/// Delete an object. If it was constructed in one of the object pools then
+/// it is destroyed in place and its storage goes back to the pool instead.
+/// If it was constructed in the level arena then it is destroyed in place
+/// and its memory is released when the arena is reset by `clear()`. Objects
+/// spawned during play were constructed on the heap and are deleted.
+/// \param pObj Pointer to an object.
+
+void CObjectManager::Destroy(CObject* pObj) {
+  RetireHandle(pObj);
+
+  if (m_cBulletPool.Free(pObj) || m_cTurretBulletPool.Free(pObj) ||
+    m_cSwordPool.Free(pObj) || m_cExplosionPool.Free(pObj) ||
+    m_cExplosion2Pool.Free(pObj) || m_cExplosion3Pool.Free(pObj))
+    return; //pooled
+
+  if (m_cArena.Owns(pObj))
+    pObj->~CObject(); //memory goes with the arena
+
+  else delete pObj;
+} //Destroy
+
+/// Give an object a handle, reusing a free slot in the handle table if there
+/// is one.
+/// \param pObj Pointer to an object.
+
+void CObjectManager::IssueHandle(CObject* pObj) {
+  UINT n = 0; //slot
+
+  if (m_vecFreeHandles.empty()) { //grow the table
+    n = (UINT)m_vecHandles.size();
+    m_vecHandles.emplace_back();
+  } //if
+
+  else { //reuse a slot
+    n = m_vecFreeHandles.back();
+    m_vecFreeHandles.pop_back();
+  } //else
+
+  m_vecHandles[n].m_pObject = pObj;
+  pObj->m_hHandle.m_nSlot = n;
+  pObj->m_hHandle.m_nGeneration = m_vecHandles[n].m_nGeneration;
+} //IssueHandle
+
+/// Free an object's slot in the handle table and advance its generation,
+/// so that every handle to the object resolves to null from now on.
+/// \param pObj Pointer to an object that is about to be deleted.
+
+void CObjectManager::RetireHandle(CObject* pObj) {
+  const UINT n = pObj->m_hHandle.m_nSlot; //slot
+  if (n == SObjectHandle::NONE)return; //never issued
+
+  m_vecHandles[n].m_pObject = nullptr;
+  m_vecHandles[n].m_nGeneration++;
+  m_vecFreeHandles.push_back(n);
+  pObj->m_hHandle = SObjectHandle();
+} //RetireHandle
+
+/// Get the object that a handle refers to. This is a bounds check and a
+/// generation check on one slot of the handle table.
+/// \param h Generational handle.
+/// \return Pointer to the object, or `nullptr` if it has been deleted.
+
+CObject* CObjectManager::Resolve(const SObjectHandle& h) {
+  if (m_pObjectManager == nullptr || h.m_nSlot >= m_pObjectManager->m_vecHandles.size())
+    return nullptr; //null handle or no object manager
+
+  const SHandleSlot& slot = m_pObjectManager->m_vecHandles[h.m_nSlot];
+  return slot.m_nGeneration == h.m_nGeneration? slot.m_pObject: nullptr;
+} //Resolve
+
+/// Get the object that a handle refers to from the object manager. This is
+/// what `CHandle` uses to resolve itself.
+/// \param h Generational handle.
+/// \return Pointer to the object, or `nullptr` if it has been deleted.
+
+CObject* ResolveHandle(const SObjectHandle& h) {
+  return CObjectManager::Resolve(h);
+} //ResolveHandle
+
+/// Make sure the object pools are big enough for the current level so that
+/// bullets, swings and explosions don't overflow onto the heap. Turrets fire
+/// continuously, so turret bullets and their explosions scale with the
+/// number of turrets. Call this at level load after the turrets have been
+/// created. Pools only grow, and only while none of their objects are in use.
+
+void CObjectManager::ReservePools() {
+  const size_t nTurrets = GetNumTurrets(); //number of turrets
+
+  m_cBulletPool.Reserve(32);
+  m_cSwordPool.Reserve(8);
+  m_cExplosionPool.Reserve(32);
+  m_cTurretBulletPool.Reserve(16 + 4*nTurrets);
+  m_cExplosion2Pool.Reserve(4 + nTurrets);
+  m_cExplosion3Pool.Reserve(16 + 4*nTurrets);
+} //ReservePools
+
+/// Start loading a level. Objects that live until the end of the level are
+/// created in the level arena until `EndLevelLoad()` is called.
+
+void CObjectManager::BeginLevelLoad() {
+  m_bLoadingLevel = true;
+} //BeginLevelLoad
+
+/// Finish loading a level. Objects created after this, during play, go on
+/// the heap so that their memory is freed when they die.
+
+void CObjectManager::EndLevelLoad() {
+  m_bLoadingLevel = false;
+} //EndLevelLoad
+
+/// Delete all of the objects, including the overlay objects, and reset the
+/// counts and handles. Pooled objects go back to their pools, and the level
+/// arena is reset once all of the objects in it have been destroyed.
+
+void CObjectManager::clear() {
+  for (std::vector<CObject*>* pList : { &m_vecObjects, &m_vecOverlay }) {
+    for (CObject* pObj : *pList)
+      Destroy(pObj);
+
+    pList->clear();
+  } //for
+
+  LBaseObjectManager::clear(); //its object list is unused
+  m_cArena.Reset(); //release the level's objects in one go
+  m_cPhysics.clear();
+  m_bStaticGrid = false; //rebuilt for the next level
+
+  std::fill(std::begin(m_nTypeCount), std::end(m_nTypeCount), 0);
+  std::fill(std::begin(m_nSpriteCount), std::end(m_nSpriteCount), 0);
+  std::fill(std::begin(m_pHandle), std::end(m_pHandle), nullptr);
+} //clear
+
+/// Change the type of an object that is already in the object list, keeping
+/// the per-type counts correct. Objects must not write to `objType` directly
+/// once they have been created.
+/// \param pObj Pointer to an object.
+/// \param t New object type.
+
+void CObjectManager::SetType(CObject* pObj, eObjectType t) {
+  m_nTypeCount[pObj->objType]--;
+  pObj->objType = (UINT)t;
+  m_nTypeCount[pObj->objType]++;
+  SetLayer(pObj);
+} //SetType
+
+/// Check the per-type and per-sprite counts and the handles against a full
+/// scan of the object list. This is slow, so it is only called in debug builds.
+
+void CObjectManager::CheckCounts() const {
+  size_t nType[(UINT)eObjectType::Size] = {0}; //object type counts
+  size_t nSprite[(UINT)eSprite::Size] = {0}; //sprite counts
+  CObject* pFirst[(UINT)eSprite::Size] = {nullptr}; //first object per sprite
+
+  for (const std::vector<CObject*>* pList : { &m_vecObjects, &m_vecOverlay })
+    for (CObject* pObj : *pList) { //for each object
+      nType[pObj->objType]++;
+      nSprite[pObj->m_nBaseSprite]++;
+
+      if (pFirst[pObj->m_nBaseSprite] == nullptr)
+        pFirst[pObj->m_nBaseSprite] = pObj;
+    } //for
+
+  for (UINT i = 0; i < (UINT)eObjectType::Size; i++)
+    assert(nType[i] == m_nTypeCount[i]);
+
+  for (UINT i = 0; i < (UINT)eSprite::Size; i++) {
+    assert(nSprite[i] == m_nSpriteCount[i]);
+    assert((HasHandle((eSprite)i)? pFirst[i]: nullptr) == m_pHandle[i]);
+  } //for
+} //CheckCounts
+
 /// Test whether an object's left, right, top or bottom edge has crossed the 
 /// left, right, top, bottom edge of the world, respectively. If so, then the
 /// object's position is corrected. This function assumes that the bottom left
@@ -131,7 +556,8 @@ CObject* CObjectManager::create(eSprite t, const Vector2& pos) {
 //  return d > 0;
 //} //AtWorldEdge
 
-/// Draw the tiled background and the objects in the object list.
+/// Draw the tiled background and the objects in the object list, in the
+/// order that they were created.
 
 void CObjectManager::draw() {
   m_pTileManager->Draw(); //draw tiled background
@@ -140,12 +566,230 @@ void CObjectManager::draw() {
   if (m_bDrawAABBs)
     m_pTileManager->DrawBoundingBoxes(eSprite::Line); //draw AABBs
 
-  LBaseObjectManager::draw();
+  for (CObject* pObj : m_vecObjects) //for each object
+    pObj->draw();
 } //draw
 
+/// Draw the overlay objects. Their positions are in screen space, so they
+/// are offset by the camera position before drawing. Call this after
+/// everything else in the frame has been drawn.
+
+void CObjectManager::DrawOverlay() {
+  const Vector3 vCamera = m_pRenderer->GetCameraPos(); //camera position
+  const Vector2 vOffset = Vector2(vCamera.x - m_nWinWidth/2.0f,
+    vCamera.y - m_nWinHeight/2.0f); //bottom left of window in world space
+
+  for (CObject* pObj : m_vecOverlay) { //for each overlay object
+    LSpriteDesc2D desc = *pObj; //copy its sprite descriptor
+    desc.m_vPos += vOffset; //to world space
+    m_pRenderer->Draw(&desc);
+  } //for
+} //DrawOverlay
+
+/// Copy the position, velocity, radius and flags of each object in the
+/// object list into its slot in the physics store.
+
+void CObjectManager::Gather() {
+  CPhysicsStore& s = m_cPhysics; //shorthand
+
+  for (CObject* pObj : m_vecObjects) { //for each object
+    const UINT n = pObj->m_nSlot; //shorthand
+
+    s.m_vecPosX[n] = pObj->m_vPos.x;
+    s.m_vecPosY[n] = pObj->m_vPos.y;
+    s.m_vecVelX[n] = pObj->m_vVelocity.x;
+    s.m_vecVelY[n] = pObj->m_vVelocity.y;
+    s.m_vecRadius[n] = pObj->m_fRadius;
+
+    s.m_vecFlags[n] = CPhysicsStore::LIVE |
+      (pObj->m_bStatic?    CPhysicsStore::STATIC: 0) |
+      (pObj->m_bDead?      CPhysicsStore::DEAD: 0) |
+      (pObj->m_bIsTarget?  CPhysicsStore::TARGET: 0) |
+      (pObj->m_bIntegrate? CPhysicsStore::INTEGRATE: 0) |
+      (pObj->m_bFixed?     CPhysicsStore::FIXED: 0);
+  } //for
+} //Gather
+
+/// Copy the integrated positions in the physics store back into the objects
+/// that the store integrates.
+
+void CObjectManager::Scatter() {
+  const CPhysicsStore& s = m_cPhysics; //shorthand
+
+  for (CObject* pObj : m_vecObjects) { //for each object
+    const UINT n = pObj->m_nSlot; //shorthand
+
+    if (s.m_vecFlags[n] & CPhysicsStore::INTEGRATE)
+      pObj->m_vPos = Vector2(s.m_vecPosX[n], s.m_vecPosY[n]);
+  } //for
+} //Scatter
+
+/// Size the uniform grids used by the broad phase to fit the world. Cells are
+/// two tiles wide so that the common enemies fit in a single cell, which means
+/// that two objects can only overlap if they are in the same or adjacent
+/// cells. If the size changes then the static grid must be rebuilt.
+
+void CObjectManager::SizeGrid() {
+  m_fCellSize = 2.0f*m_pTileManager->GetTileSize();
+  const size_t w = std::max<size_t>(1, (size_t)ceilf(m_vWorldSize.x/m_fCellSize));
+  const size_t h = std::max<size_t>(1, (size_t)ceilf(m_vWorldSize.y/m_fCellSize));
+
+  if (w != m_nGridWidth || h != m_nGridHeight) { //world size changed
+    m_nGridWidth = w;
+    m_nGridHeight = h;
+    m_vecCells.clear();
+    m_vecCells.resize(w*h);
+    m_vecOccupied.clear();
+    m_bStaticGrid = false;
+  } //if
+} //SizeGrid
+
+/// Rebuild the grid of moving objects used by the broad phase. Objects whose
+/// diameter is larger than a cell are kept in `m_vecLarge` instead. Objects
+/// outside the world are clamped into the border cells. Positions and radii
+/// are read from the physics store. Static objects are in the static grid,
+/// so they are skipped.
+
+void CObjectManager::BuildGrid() {
+  for (const size_t n : m_vecOccupied) //empty cells from last time
+    m_vecCells[n].clear();
+
+  m_vecOccupied.clear();
+  m_vecLarge.clear();
+  SizeGrid();
+
+  const size_t w = m_nGridWidth; //shorthand
+  const size_t h = m_nGridHeight; //shorthand
+  const CPhysicsStore& s = m_cPhysics; //shorthand
+  const UINT nSlots = (UINT)s.GetSize(); //number of slots
+  const UINT8 mask = CPhysicsStore::LIVE | CPhysicsStore::DEAD | CPhysicsStore::FIXED;
+
+  for (UINT k = 0; k < nSlots; k++) { //for each slot
+    if ((s.m_vecFlags[k] & mask) != CPhysicsStore::LIVE)
+      continue; //free, dead or static
+
+    if (2.0f*s.m_vecRadius[k] > m_fCellSize) { //too big for a cell
+      m_vecLarge.push_back(k);
+      continue;
+    } //if
+
+    const int i = Clamp((int)floorf(s.m_vecPosX[k]/m_fCellSize), (int)w - 1, 0);
+    const int j = Clamp((int)floorf(s.m_vecPosY[k]/m_fCellSize), (int)h - 1, 0);
+    const size_t n = j*w + i; //cell index
+
+    if (m_vecCells[n].empty())
+      m_vecOccupied.push_back(n);
+
+    m_vecCells[n].push_back(k);
+  } //for
+} //BuildGrid
+
+/// Bin the static objects in the object list into the static grid. Call this
+/// once per level after the level's objects have been created. From then
+/// on static objects are added to and removed from the grid as they are
+/// created and destroyed, so nothing is rebinned per frame.
+
+void CObjectManager::BuildStaticGrid() {
+  SizeGrid();
+  m_vecStaticCells.clear();
+  m_vecStaticCells.resize(m_nGridWidth*m_nGridHeight);
+  m_vecStaticLarge.clear();
+  m_bStaticGrid = true;
+
+  for (CObject* pObj : m_vecObjects) //for each object
+    if (pObj->m_bFixed)
+      AddStatic(pObj);
+} //BuildStaticGrid
+
+/// Add a static object to the static grid, or to `m_vecStaticLarge` if it
+/// is too large for a single cell. Its cell is remembered so that it can be
+/// found again by `RemoveStatic()`. Large objects are recorded as being in
+/// the cell one past the end of the grid.
+/// \param pObj Pointer to a static object.
+
+void CObjectManager::AddStatic(CObject* pObj) {
+  const UINT k = pObj->m_nSlot; //shorthand
+  const size_t nCells = m_vecStaticCells.size(); //number of cells
+
+  if (k >= m_vecStaticCellOf.size())
+    m_vecStaticCellOf.resize(k + 1);
+
+  if (2.0f*pObj->m_fRadius > m_fCellSize) { //too big for a cell
+    m_vecStaticLarge.push_back(k);
+    m_vecStaticCellOf[k] = nCells;
+  } //if
+
+  else {
+    const int i = Clamp((int)floorf(pObj->m_vPos.x/m_fCellSize), (int)m_nGridWidth - 1, 0);
+    const int j = Clamp((int)floorf(pObj->m_vPos.y/m_fCellSize), (int)m_nGridHeight - 1, 0);
+    const size_t n = j*m_nGridWidth + i; //cell index
+
+    m_vecStaticCells[n].push_back(k);
+    m_vecStaticCellOf[k] = n;
+  } //else
+} //AddStatic
+
+/// Remove a static object from the static grid.
+/// \param pObj Pointer to a static object.
+
+void CObjectManager::RemoveStatic(CObject* pObj) {
+  const UINT k = pObj->m_nSlot; //shorthand
+  const size_t n = m_vecStaticCellOf[k]; //cell index
+  std::vector<UINT>& v = n < m_vecStaticCells.size()? m_vecStaticCells[n]: m_vecStaticLarge;
+
+  auto i = std::find(v.begin(), v.end(), k);
+
+  if (i != v.end()) { //swap with last and pop
+    *i = v.back();
+    v.pop_back();
+  } //if
+} //RemoveStatic
+
+/// Pair a moving object with the static objects in a cell of the static
+/// grid and its eight neighbours, and with the large static objects.
+/// \param k Physics slot of the moving object.
+/// \param i Column of the moving object's cell.
+/// \param j Row of the moving object's cell.
+
+void CObjectManager::TestStatic(UINT k, int i, int j) {
+  const int i0 = std::max<int>(i - 1, 0);
+  const int i1 = std::min<int>(i + 1, (int)m_nGridWidth - 1);
+  const int j0 = std::max<int>(j - 1, 0);
+  const int j1 = std::min<int>(j + 1, (int)m_nGridHeight - 1);
+
+  for (int nj = j0; nj <= j1; nj++)
+    for (int ni = i0; ni <= i1; ni++)
+      for (const UINT m : m_vecStaticCells[nj*m_nGridWidth + ni])
+        TestPair(k, m);
+
+  for (const UINT m : m_vecStaticLarge)
+    TestPair(k, m);
+} //TestStatic
+
+/// Call the narrow phase on a pair of objects provided neither of them has
+/// died earlier in this broad phase and their collision layers interact.
+/// \param n0 Physics slot of the first object.
+/// \param n1 Physics slot of the second object.
+
+void CObjectManager::TestPair(UINT n0, UINT n1) {
+  CObject* p0 = m_cPhysics.m_vecObject[n0]; //first object
+  CObject* p1 = m_cPhysics.m_vecObject[n1]; //second object
+
+  if (!p0->m_bDead && !p1->m_bDead) {
+    if (p0->m_nCollisionMask & p1->m_nLayer) { //can interact
+      m_nPairTests++;
+      NarrowPhase(p0, p1);
+    } //if
+
+    else m_nPairsSkipped++;
+  } //if
+} //TestPair
 /// Perform collision detection and response for each object with the world
 /// edges and for all objects with another object, making sure that each pair
-/// of objects is processed only once.
+/// of objects is processed only once. Moving objects are binned into a
+/// uniform grid first so that only objects in neighbouring cells are paired
+/// up, and are paired with static objects through the static grid. Pairs of
+/// static objects are never tested.
 
 //void CObjectManager::BroadPhase(){
 //  LBaseObjectManager::BroadPhase(); //collide with other objects
@@ -165,13 +809,76 @@ void CObjectManager::draw() {
 //} //BroadPhase
 
 void CObjectManager::BroadPhase() {
-  LBaseObjectManager::BroadPhase(); //collide with other objects
+  m_nPairTests = 0;
+  m_nPairsSkipped = 0;
+  BuildGrid(); //bin moving objects into cells
+
+  if (!m_bStaticGrid) //not built for this level yet
+    BuildStaticGrid();
+
+  //collide objects in the same cell or a neighbouring cell. Only the four
+  //neighbours right and above are visited so that each pair is tested once.
+
+  static const int dx[4] = { 1, -1, 0, 1 }; //neighbour column offsets
+  static const int dy[4] = { 0,  1, 1, 1 }; //neighbour row offsets
+
+  for (const size_t n : m_vecOccupied) { //for each occupied cell
+    const std::vector<UINT>& cell = m_vecCells[n];
+    const int i = (int)(n % m_nGridWidth); //column
+    const int j = (int)(n / m_nGridWidth); //row
+
+    for (size_t a = 0; a < cell.size(); a++) {
+      for (size_t b = a + 1; b < cell.size(); b++) //same cell
+        TestPair(cell[a], cell[b]);
+
+      for (int k = 0; k < 4; k++) { //neighbouring cells
+        const int ni = i + dx[k];
+        const int nj = j + dy[k];
+
+        if (ni >= 0 && ni < (int)m_nGridWidth && nj < (int)m_nGridHeight)
+          for (const UINT m : m_vecCells[nj*m_nGridWidth + ni])
+            TestPair(cell[a], m);
+      } //for
+    } //for
+  } //for
+
+  //large objects may overlap anything, so test them against everything
+
+  for (size_t a = 0; a < m_vecLarge.size(); a++) {
+    for (size_t b = a + 1; b < m_vecLarge.size(); b++)
+      TestPair(m_vecLarge[a], m_vecLarge[b]);
+
+    for (const size_t n : m_vecOccupied)
+      for (const UINT k : m_vecCells[n])
+        TestPair(m_vecLarge[a], k);
+  } //for
+
+  //moving objects against static objects
+
+  for (const size_t n : m_vecOccupied) { //for each occupied cell
+    const int i = (int)(n % m_nGridWidth); //column
+    const int j = (int)(n / m_nGridWidth); //row
 
-  //collide with walls
+    for (const UINT k : m_vecCells[n])
+      TestStatic(k, i, j);
+  } //for
+
+  for (const UINT k : m_vecLarge) { //large moving objects against all of them
+    for (const std::vector<UINT>& cell : m_vecStaticCells)
+      for (const UINT m : cell)
+        TestPair(k, m);
+
+    for (const UINT m : m_vecStaticLarge)
+      TestPair(k, m);
+  } //for
+
+  //collide with walls. Collision response may create objects, so walk by index
+
+  for (size_t i = 0; i < m_vecObjects.size(); i++) { //for each object
+    CObject* pObj = m_vecObjects[i]; //shorthand
 
-  for (CObject* pObj : m_stdObjectList) //for each object
     if (!pObj->m_bDead) { //for each non-dead object, that is
-      for (int i = 0; i < 2; i++) { //can collide with 2 edges simultaneously
+      for (int j = 0; j < 2; j++) { //can collide with 2 edges simultaneously
         Vector2 norm; //collision normal
         float d = 0; //overlap distance
         BoundingSphere s(Vector3(pObj->m_vPos), pObj->m_fRadius);
@@ -179,7 +886,8 @@ void CObjectManager::BroadPhase() {
         if (m_pTileManager->CollideWithWall(s, norm, d)) //collide with wall
           pObj->CollisionResponse(norm, d); //respond 
       } //for
-    } //for
+    } //if
+  } //for
 } //BroadPhase
 
 
@@ -221,7 +929,7 @@ void CObjectManager::FireGun(CObject* pObj, eSprite bullet) {
   CObject* pBullet = create(bullet, pos); //create bullet
 
   const Vector2 norm = VectorNormalCC(view); //normal to view direction
-  const float m = 2.0f * m_pRandom->randf() - 1.0f; //random deflection magnitude
+  const float m = 2.0f * m_cAIRandom.randf() - 1.0f; //random deflection magnitude
   const Vector2 deflection = 0.01f * m * norm; //random deflection
 
   pBullet->m_vVelocity = pObj->m_vVelocity + 500.0f * (view + deflection);
@@ -242,7 +950,7 @@ void CObjectManager::FireGun(CObject* pObj, eSprite bullet) {
   //d.m_fMaxScale = 0.5f;
   //d.m_f4Tint = XMFLOAT4(Colors::Yellow);
 
-  //m_pParticleEngine->create(d);
+  //m_pParticleStore->create(d);
 } //FireGun
 
 void CObjectManager::SwingSword(CObject* pObj, eSprite sword) {
@@ -255,7 +963,7 @@ void CObjectManager::SwingSword(CObject* pObj, eSprite sword) {
   CObject* pSword = create(sword, pos); //create sword
 
   const Vector2 norm = VectorNormalCC(view); //normal to view direction
-  const float m = 2.0f * m_pRandom->randf() - 1.0f; //random deflection magnitude
+  const float m = 2.0f * m_cAIRandom.randf() - 1.0f; //random deflection magnitude
   const Vector2 deflection = 0.01f * m * norm; //random deflection
 
   pSword->m_fRoll = pObj->m_fFacingVector;
@@ -282,81 +990,84 @@ void CObjectManager::SwingSword(CObject* pObj, eSprite sword) {
 //} //FindClose
 
 const size_t CObjectManager::GetNumTurrets() const {
-  size_t n = 0; //number of turrets
-
-  for (CObject* pObj : m_stdObjectList) //for each object
-    if (pObj->m_nSpriteIndex == (UINT)eSprite::Turret)
-      n++;
-
-  return n;
+  return m_nTypeCount[(UINT)eObjectType::TURRET];
 } //GetNumTurrets
 
 const size_t CObjectManager::GetEnemyCount() const {
-    size_t n = 0; //number of enemies
+    return m_nTypeCount[(UINT)eObjectType::TURRET] +
+           m_nTypeCount[(UINT)eObjectType::SLIME] +
+           m_nTypeCount[(UINT)eObjectType::OAKSEED] +
+           m_nTypeCount[(UINT)eObjectType::RABITE];
+} //GetEnemyCount
 
-    for (CObject* pObj : m_stdObjectList) //for each object
-        if (pObj->objType == (UINT)eObjectType::TURRET ||
-            pObj->objType == (UINT)eObjectType::SLIME ||
-            pObj->objType == (UINT)eObjectType::OAKSEED ||
-            pObj->objType == (UINT)eObjectType::RABITE)
-            n++;
+/// Reader function for the number of objects of a given type.
+/// \param t Object type.
+/// \return Number of objects of that type in the object list.
 
-    return n;
-} //GetEnemyCount
+const size_t CObjectManager::GetCount(eObjectType t) const {
+    return m_nTypeCount[(UINT)t];
+} //GetCount
 
 NextMapPorter* CObjectManager::GetNextMap() {
-    NextMapPorter* next_map;
-    for (CObject* pObj : m_stdObjectList) {
-        if (pObj->m_nSpriteIndex == (UINT)eSprite::NextPortal) {
-            next_map = (NextMapPorter*)pObj;
-            return next_map;
-        }
-    }
-    return nullptr;
-}
+    return (NextMapPorter*)m_pHandle[(UINT)eSprite::NextPortal];
+} //GetNextMap
 
 PrevMapPorter* CObjectManager::GetPreviousMap() {
-    PrevMapPorter* prev_map;
-    for (CObject* pObj : m_stdObjectList) {
-        if (pObj->m_nSpriteIndex == (UINT)eSprite::PrevPortal) {
-            prev_map = (PrevMapPorter*)pObj;
-            return prev_map;
-        }
-    }
-    return nullptr;
-}
+    return (PrevMapPorter*)m_pHandle[(UINT)eSprite::PrevPortal];
+} //GetPreviousMap
 
-FadeOutObject* CObjectManager::GetFadeOut()
-{
-    FadeOutObject* fade_out;
-    for (CObject* pObj : m_stdObjectList) {
-        if (pObj->m_nSpriteIndex == (UINT)eSprite::FadeOut) {
-            fade_out = (FadeOutObject*)pObj;
-            return fade_out;
-        }
-    }
-    return nullptr;
-}
+FadeOutObject* CObjectManager::GetFadeOut() {
+    return (FadeOutObject*)m_pHandle[(UINT)eSprite::FadeOut];
+} //GetFadeOut
 
-FadeInObject* CObjectManager::GetFadeIn()
-{
-    FadeInObject* fade_in;
-    for (CObject* pObj : m_stdObjectList) {
-        if (pObj->m_nSpriteIndex == (UINT)eSprite::FadeIn) {
-            fade_in = (FadeInObject*)pObj;
-            return fade_in;
-        }
-    }
-    return nullptr;
-}
+FadeInObject* CObjectManager::GetFadeIn() {
+    return (FadeInObject*)m_pHandle[(UINT)eSprite::FadeIn];
+} //GetFadeIn
 
 TitleCard* CObjectManager::GetTitleCard() {
-    TitleCard* title;
-    for (CObject* pObj : m_stdObjectList) {
-        if (pObj->m_nSpriteIndex == (UINT)eSprite::Titlecard) {
-            title = (TitleCard*)pObj;
-            return title;
-        }
-    }
-    return nullptr;
-}
\ No newline at end of file
+    return (TitleCard*)m_pHandle[(UINT)eSprite::Titlecard];
+} //GetTitleCard
+
+/// Reader function for the number of narrow phase pair tests made in the
+/// most recent broad phase. Use this to keep an eye on broad phase cost.
+/// \return Number of pair tests.
+
+const size_t CObjectManager::GetPairTests() const {
+  return m_nPairTests;
+} //GetPairTests
+
+/// Reader function for the number of pairs that the collision mask rejected
+/// in the most recent broad phase without calling the narrow phase.
+/// \return Number of pairs skipped.
+
+const size_t CObjectManager::GetPairsSkipped() const {
+  return m_nPairsSkipped;
+} //GetPairsSkipped
+
+/// Reader function for the number of objects created from the object pools.
+/// \return Number of pooled allocations since the program started.
+
+const size_t CObjectManager::GetPooledAllocs() const {
+  return m_cBulletPool.GetPooledAllocs() + m_cTurretBulletPool.GetPooledAllocs() +
+    m_cSwordPool.GetPooledAllocs() + m_cExplosionPool.GetPooledAllocs() +
+    m_cExplosion2Pool.GetPooledAllocs() + m_cExplosion3Pool.GetPooledAllocs();
+} //GetPooledAllocs
+
+/// Reader function for the number of pooled object types that were created
+/// on the heap because their pool was full. This should stay at zero once a
+/// level has been loaded.
+/// \return Number of heap allocations since the program started.
+
+const size_t CObjectManager::GetHeapAllocs() const {
+  return m_cBulletPool.GetHeapAllocs() + m_cTurretBulletPool.GetHeapAllocs() +
+    m_cSwordPool.GetHeapAllocs() + m_cExplosionPool.GetHeapAllocs() +
+    m_cExplosion2Pool.GetHeapAllocs() + m_cExplosion3Pool.GetHeapAllocs();
+} //GetHeapAllocs
+
+/// Reader function for the level arena, so that its memory use can be
+/// reported.
+/// \return Reference to the level arena.
+
+const CArena& CObjectManager::GetArena() const {
+  return m_cArena;
+} //GetArena
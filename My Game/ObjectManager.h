@@ -4,44 +4,183 @@
 #ifndef __L4RC_GAME_OBJECTMANAGER_H__
 #define __L4RC_GAME_OBJECTMANAGER_H__
 
+#include <vector>
+
 #include "BaseObjectManager.h"
 #include "Object.h"
 #include "Common.h"
+#include "Settings.h"
+#include "TileManager.h"
+#include "PhysicsStore.h"
+#include "ObjectPool.h"
+#include "Arena.h"
+#include "Bullet.h"
+#include "TurretBullet.h"
+#include "SwordAttack.h"
+#include "Explosion.h"
+#include "Explosion2.h"
+#include "Explosion3.h"
 #include "NextMapPorter.h"
 #include "PrevMapPorter.h"
 #include "FadeInObject.h"
 #include "FadeOutObject.h"
 #include "TitleCard.h"
 
+/// \brief A slot in the object manager's handle table.
+
+struct SHandleSlot{
+  CObject* m_pObject = nullptr; ///< Object using this slot, if any.
+  UINT m_nGeneration = 0; ///< Incremented each time the slot is freed.
+}; //SHandleSlot
+
 /// \brief The object manager.
 ///
-/// A collection of all of the game objects.
+/// A collection of all of the game objects. HUD elements, menu items and
+/// full-screen sprites go in a separate overlay list instead of the object
+/// list. Both lists are dense vectors of pointers in creation order, which is
+/// also the draw order, and dead objects are compacted out of them in a single
+/// pass at the end of each frame. The object list inherited from
+/// `LBaseObjectManager` is not used. Overlay objects are positioned in screen space (origin at the bottom
+/// left of the window), are never collision tested, and are drawn after
+/// everything else.
+///
+/// Objects that never move, such as turrets, spikes, potions, keys and
+/// portals, are binned once per level into a static grid that changes only
+/// when one of them is created or destroyed. Each frame only the moving
+/// objects are binned, and the broad phase pairs moving objects with each
+/// other and with the static grid, but never static objects with each other.
+///
+/// Bullets, sword swings and explosions are created and destroyed many times
+/// a second, so they are constructed in fixed-capacity object pools that are
+/// pre-warmed at level load instead of on the heap. Players, enemies, items
+/// and portals placed by the level live until the end of the level, so while
+/// the level is being loaded they are constructed in an arena that is
+/// released in one go when the objects are cleared. The arena never frees
+/// anything before that, so objects spawned during play, such as the slimes
+/// that the king slime summons and the potions that enemies drop, go on the
+/// heap instead and are deleted when they die.
+///
+/// Each object is issued a generational handle when it is created, so that
+/// other code can refer to it without holding a pointer that would dangle
+/// once it is deleted or moved.
 
 class CObjectManager: 
   public LBaseObjectManager<CObject>,
-  public CCommon
+  public CCommon,
+  public LSettings
 {
   private:
+    std::vector<CObject*> m_vecObjects; ///< World-space objects in creation order.
+    std::vector<CObject*> m_vecOverlay; ///< Screen-space overlay objects in creation order.
+    std::vector<CObject*> m_vecDead; ///< Scratch space for culling dead objects.
+    std::vector<SHandleSlot> m_vecHandles; ///< Handle table.
+    std::vector<UINT> m_vecFreeHandles; ///< Free slots in the handle table.
+    CPhysicsStore m_cPhysics; ///< Structure-of-arrays physics data for the object list.
+
+    std::vector<std::vector<UINT>> m_vecCells; ///< Broad phase grid cells of physics slots, row major.
+    std::vector<size_t> m_vecOccupied; ///< Indices of the grid cells that are not empty.
+    std::vector<UINT> m_vecLarge; ///< Slots of objects too large to fit in a single grid cell.
+    std::vector<std::vector<UINT>> m_vecStaticCells; ///< Static grid cells of physics slots, row major.
+    std::vector<UINT> m_vecStaticLarge; ///< Slots of static objects too large to fit in a single grid cell.
+    std::vector<size_t> m_vecStaticCellOf; ///< Static grid cell of each physics slot.
+    bool m_bStaticGrid = false; ///< Whether the static grid has been built for this level.
+
+    CObjectPool<CBullet> m_cBulletPool; ///< Pool of player bullets.
+    CObjectPool<CTurretBullet> m_cTurretBulletPool; ///< Pool of turret bullets.
+    CObjectPool<CSwordAttack> m_cSwordPool; ///< Pool of sword swings.
+    CObjectPool<CExplosion> m_cExplosionPool; ///< Pool of bullet explosions.
+    CObjectPool<CExplosion2> m_cExplosion2Pool; ///< Pool of turret explosions.
+    CObjectPool<CExplosion3> m_cExplosion3Pool; ///< Pool of turret bullet explosions.
+    CArena m_cArena; ///< Memory for objects that live until the end of the level.
+    bool m_bLoadingLevel = false; ///< Whether objects are being created by the level load.
+
+    size_t m_nGridWidth = 0; ///< Number of grid cells wide.
+    size_t m_nGridHeight = 0; ///< Number of grid cells high.
+    float m_fCellSize = 0.0f; ///< Grid cell width and height.
+    size_t m_nPairTests = 0; ///< Number of narrow phase pair tests in the last broad phase.
+    size_t m_nPairsSkipped = 0; ///< Number of pairs rejected by collision mask in the last broad phase.
+
+    UINT m_nInteracts[(UINT)eObjectType::Size] = {0}; ///< Collision layer interaction matrix, one row per object type.
+
+    void MakeInteractionMatrix(); ///< Fill in the collision layer interaction matrix.
+    void SetLayer(CObject*); ///< Set an object's collision layer and mask from its type.
+
+    size_t m_nTypeCount[(UINT)eObjectType::Size] = {0}; ///< Number of objects of each type.
+    size_t m_nSpriteCount[(UINT)eSprite::Size] = {0}; ///< Number of objects constructed with each sprite.
+    CObject* m_pHandle[(UINT)eSprite::Size] = {nullptr}; ///< Oldest object constructed with each sprite that has a handle.
+
+    void Register(CObject*); ///< Add an object to the counts and handles.
+    void Unregister(CObject*); ///< Remove an object from the counts and handles.
+    void CullDeadObjects(std::vector<CObject*>&); ///< Delete dead objects and unregister them.
+    void Destroy(CObject*); ///< Delete an object or return it to its pool.
+    void IssueHandle(CObject*); ///< Give an object a handle.
+    void RetireHandle(CObject*); ///< Make an object's handles stale.
+    static const bool IsOverlay(eSprite); ///< Whether a sprite belongs in the overlay.
+    static const bool HasHandle(eSprite); ///< Whether a sprite's oldest object is kept track of.
+    void CheckCounts() const; ///< Debug check of the counts against the object list.
+
+    void Gather(); ///< Copy object physics data into the physics store.
+    void Scatter(); ///< Copy integrated positions back into the objects.
+    void SizeGrid(); ///< Size the broad phase grids to fit the world.
+    void BuildGrid(); ///< Bin moving objects into the broad phase grid.
+    void AddStatic(CObject*); ///< Add an object to the static grid.
+    void RemoveStatic(CObject*); ///< Remove an object from the static grid.
+    void TestStatic(UINT, int, int); ///< Pair a moving object with static objects near a grid cell.
+    static const bool IsFixed(eSprite); ///< Whether a sprite never moves.
+    void TestPair(UINT, UINT); ///< Narrow phase on a pair of slots if they interact.
     void BroadPhase(); ///< Broad phase collision detection and response.
     void NarrowPhase(CObject*, CObject*); ///< Narrow phase collision detection and response.
+    template<class T, class... Args> T* Make(Args&&...); ///< Construct an object in the arena or on the heap.
     //bool AtWorldEdge(CObject*, Vector2&, float&) const; ///< Test whether at the edge of the world.
 
   public:
+    CObjectManager(); ///< Constructor.
+    ~CObjectManager(); ///< Destructor.
+
     CObject* create(eSprite, const Vector2&); ///< Create new object.
+    void move(); ///< Move all objects, collide them, and cull the dead ones.
+    void clear(); ///< Delete all objects.
+    void BeginLevelLoad(); ///< Create objects in the level arena from now on.
+    void EndLevelLoad(); ///< Create objects on the heap from now on.
+    void BuildStaticGrid(); ///< Bin the static objects into the static grid.
+    void ReservePools(); ///< Pre-warm the object pools for this level.
+    void SetType(CObject*, eObjectType); ///< Change an object's type.
 
     virtual void draw(); ///< Draw all objects.
+    void DrawOverlay(); ///< Draw the overlay objects.
 
     void FireGun(CObject*, eSprite); ///< Fire object's gun.
     void SwingSword(CObject*, eSprite); ///< Swing object's Sword.
     //void FindClosest(const Vector2&, CObject*&, float&); ///< Find close objects.
     const size_t GetNumTurrets() const; ///< Get number of turrets in object list.
     const size_t GetEnemyCount() const; ///< Get number of enemies as size_t
-    NextMapPorter* GetNextMap();
-    PrevMapPorter* GetPreviousMap();
-    FadeOutObject* GetFadeOut();
-    FadeInObject* GetFadeIn();
-    TitleCard* GetTitleCard();
+    const size_t GetCount(eObjectType) const; ///< Get number of objects of a type.
+    NextMapPorter* GetNextMap(); ///< Get the exit portal, if any.
+    PrevMapPorter* GetPreviousMap(); ///< Get the entry portal, if any.
+    FadeOutObject* GetFadeOut(); ///< Get the fade out screen, if any.
+    FadeInObject* GetFadeIn(); ///< Get the fade in screen, if any.
+    TitleCard* GetTitleCard(); ///< Get the title card, if any.
+
+    const size_t GetPairTests() const; ///< Get number of pair tests in the last broad phase.
+    const size_t GetPairsSkipped() const; ///< Get number of pairs skipped in the last broad phase.
+    const size_t GetPooledAllocs() const; ///< Get number of objects created from the pools.
+    const size_t GetHeapAllocs() const; ///< Get number of pool overflows onto the heap.
+    const CArena& GetArena() const; ///< Get the level arena.
+    static CObject* Resolve(const SObjectHandle&); ///< Get the object a handle refers to.
 
 }; //CObjectManager
 
+/// Construct an object that can live until the end of the level. While the
+/// level is being loaded it goes in the level arena, otherwise on the heap,
+/// so that the arena can't grow during play.
+/// \param args Constructor parameters.
+/// \return Pointer to the object.
+
+template<class T, class... Args> T* CObjectManager::Make(Args&&... args){
+  if(m_bLoadingLevel)
+    return m_cArena.Create<T>(std::forward<Args>(args)...);
+
+  return new T(std::forward<Args>(args)...);
+} //Make
+
 #endif //__L4RC_GAME_OBJECTMANAGER_H__
\ No newline at end of file
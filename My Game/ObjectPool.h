@@ -0,0 +1,134 @@
+/// \file ObjectPool.h
+/// \brief Interface and code for the object pool template CObjectPool.
+
+#ifndef __L4RC_GAME_OBJECTPOOL_H__
+#define __L4RC_GAME_OBJECTPOOL_H__
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+/// \brief A fixed-capacity pool of objects of one type.
+///
+/// Storage for the objects is allocated once by `Reserve()` and the objects
+/// are constructed in place, so short-lived objects such as bullets and
+/// explosions can be created and destroyed without touching the heap. Free
+/// storage is kept on a free list. If the pool runs out then `Alloc()` falls
+/// back to `new` and counts it, so the counters show whether the capacity
+/// is big enough. The owner must free every pooled object before the pool
+/// is destroyed.
+/// \tparam T Object type.
+
+template<class T> class CObjectPool{
+  private:
+    typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot; ///< Storage for one object.
+
+    std::vector<Slot> m_vecStorage; ///< Storage for the objects.
+    std::vector<T*> m_vecFree; ///< Free storage.
+
+    size_t m_nLive = 0; ///< Number of pooled objects in use.
+    size_t m_nPooled = 0; ///< Number of allocations from the pool.
+    size_t m_nHeap = 0; ///< Number of allocations that fell back to the heap.
+
+  public:
+    void Reserve(size_t); ///< Make sure the pool has a minimum capacity.
+    template<class... Args> T* Alloc(Args&&...); ///< Create an object.
+    template<class U> const bool Free(U*); ///< Destroy an object if it came from this pool.
+    template<class U> const bool Owns(const U*) const; ///< Whether an object came from this pool.
+
+    const size_t GetCapacity() const; ///< Get capacity.
+    const size_t GetPooledAllocs() const; ///< Get number of allocations from the pool.
+    const size_t GetHeapAllocs() const; ///< Get number of allocations from the heap.
+}; //CObjectPool
+
+/// Make sure that the pool can hold at least a given number of objects. The
+/// storage can only be reallocated while there are no pooled objects in use,
+/// since reallocating it would move them, so call this at level load.
+/// \param n Minimum capacity.
+
+template<class T> void CObjectPool<T>::Reserve(size_t n){
+  if(n <= m_vecStorage.size() || m_nLive > 0)
+    return; //big enough, or can't move the objects
+
+  m_vecStorage.clear();
+  m_vecStorage.resize(n);
+  m_vecFree.clear();
+  m_vecFree.reserve(n);
+
+  for(size_t i=n; i>0; i--) //so that the first slot is handed out first
+    m_vecFree.push_back(reinterpret_cast<T*>(&m_vecStorage[i - 1]));
+} //Reserve
+
+/// Construct an object in free storage from the pool, or on the heap if the
+/// pool is empty.
+/// \param args Constructor parameters.
+/// \return Pointer to the object.
+
+template<class T> template<class... Args> T* CObjectPool<T>::Alloc(Args&&... args){
+  if(m_vecFree.empty()){ //out of storage
+    m_nHeap++;
+    return new T(std::forward<Args>(args)...);
+  } //if
+
+  T* p = m_vecFree.back();
+  m_vecFree.pop_back();
+  m_nLive++;
+  m_nPooled++;
+
+  return new(p) T(std::forward<Args>(args)...);
+} //Alloc
+
+/// Destroy an object and return its storage to the free list, provided
+/// it came from this pool.
+/// \param p Pointer to the object.
+/// \return true if the object came from this pool and was destroyed.
+
+template<class T> template<class U> const bool CObjectPool<T>::Free(U* p){
+  if(!Owns(p))return false;
+
+  T* pT = static_cast<T*>(p);
+  pT->~T();
+  m_vecFree.push_back(pT);
+  m_nLive--;
+
+  return true;
+} //Free
+
+/// Determine whether an object's storage belongs to this pool.
+/// \param p Pointer to an object.
+/// \return true if the object is in this pool's storage.
+
+template<class T> template<class U> const bool CObjectPool<T>::Owns(const U* p) const{
+  if(m_vecStorage.empty())return false;
+
+  const void* q = static_cast<const void*>(p); //address
+  const void* first = &m_vecStorage.front(); //start of storage
+  const void* last = &m_vecStorage.back(); //last slot
+
+  return std::less_equal<const void*>()(first, q) && std::less_equal<const void*>()(q, last);
+} //Owns
+
+/// Reader function for the capacity.
+/// \return Maximum number of pooled objects.
+
+template<class T> const size_t CObjectPool<T>::GetCapacity() const{
+  return m_vecStorage.size();
+} //GetCapacity
+
+/// Reader function for the number of allocations from the pool.
+/// \return Number of allocations from the pool since the program started.
+
+template<class T> const size_t CObjectPool<T>::GetPooledAllocs() const{
+  return m_nPooled;
+} //GetPooledAllocs
+
+/// Reader function for the number of allocations that fell back to the heap.
+/// \return Number of heap allocations since the program started.
+
+template<class T> const size_t CObjectPool<T>::GetHeapAllocs() const{
+  return m_nHeap;
+} //GetHeapAllocs
+
+#endif //__L4RC_GAME_OBJECTPOOL_H__
@@ -0,0 +1,124 @@
+/// \file ParticleBudget.cpp
+/// \brief Code for the particle budget CParticleBudget.
+
+#include <algorithm>
+
+#include "ParticleBudget.h"
+#include "ComponentIncludes.h"
+
+static const float DOWNSAMPLE_FROM = 0.5f; ///< Fill at which downsampling starts.
+static const float PRIORITY_RESERVE = 0.1f; ///< Fraction of the global budget held back per priority level.
+static const float DISTANCE_PENALTY = 0.25f; ///< Extra fill for a particle at or beyond the edge of the window.
+
+/// Set the default budget and quotas. Combat feedback has the highest
+/// priority, then trails, then ambient effects.
+
+CParticleBudget::CParticleBudget(){
+  SetBudget(8192);
+  SetQuota(eParticleCategory::Combat, 4096, 0);
+  SetQuota(eParticleCategory::Trail, 3072, 1);
+  SetQuota(eParticleCategory::Ambience, 1024, 2);
+} //constructor
+
+/// Writer function for the global budget.
+/// \param n Most live particles in total.
+
+void CParticleBudget::SetBudget(size_t n){
+  m_nBudget = n;
+} //SetBudget
+
+/// Set a category's quota and priority.
+/// \param c Particle category.
+/// \param n Most live particles in the category.
+/// \param p Priority, zero being the highest.
+
+void CParticleBudget::SetQuota(eParticleCategory c, size_t n, UINT p){
+  SParticleQuota& q = m_sQuota[(UINT)c];
+  q.m_nQuota = n;
+  q.m_nPriority = p;
+} //SetQuota
+
+/// Decide whether a new particle may be created, and if so count it as live.
+/// \param c Particle category.
+/// \param d Distance from the camera as a fraction of the distance from the
+/// center of the window to a corner.
+/// \return true if the particle may be created.
+
+const bool CParticleBudget::Admit(eParticleCategory c, float d){
+  SParticleQuota& q = m_sQuota[(UINT)c];
+
+  const float limit = m_nBudget*std::max<float>(0.0f, 1.0f - PRIORITY_RESERVE*q.m_nPriority); //share of global budget
+  const float fill = std::max<float>((float)q.m_nLive/q.m_nQuota, (float)m_nLive/limit) +
+    DISTANCE_PENALTY*std::min<float>(1.0f, d); //fill, penalized by distance
+
+  if(q.m_nLive >= q.m_nQuota || (float)m_nLive >= limit || fill >= 1.0f){ //no room
+    m_sCount.m_nRejected++;
+    return false;
+  } //if
+
+  if(fill > DOWNSAMPLE_FROM && //downsample
+    m_cEffectsRandom.randf() > (1.0f - fill)/(1.0f - DOWNSAMPLE_FROM))
+  {
+    m_sCount.m_nThinned++;
+    return false;
+  } //if
+
+  q.m_nLive++;
+  m_nLive++;
+  m_sCount.m_nAdmitted++;
+
+  return true;
+} //Admit
+
+/// Note that a particle has died.
+/// \param c Particle category.
+
+void CParticleBudget::Remove(eParticleCategory c){
+  m_sQuota[(UINT)c].m_nLive--;
+  m_nLive--;
+} //Remove
+
+/// Keep the counts of particles admitted, thinned and rejected since the
+/// last call for the reader functions, and start counting again.
+
+void CParticleBudget::BeginFrame(){
+  m_sLast = m_sCount;
+  m_sCount = SParticleCounts();
+} //BeginFrame
+
+/// Note that all particles have been removed.
+
+void CParticleBudget::clear(){
+  for(SParticleQuota& q: m_sQuota)
+    q.m_nLive = 0;
+
+  m_nLive = 0;
+} //clear
+
+/// Reader function for the budget utilisation.
+/// \return Fraction of the global budget in use.
+
+const float CParticleBudget::GetUtilisation() const{
+  return m_nBudget > 0? (float)m_nLive/m_nBudget: 0.0f;
+} //GetUtilisation
+
+/// Reader function for the number of particles admitted.
+/// \return Number of particles admitted in the last frame.
+
+const size_t CParticleBudget::GetAdmitted() const{
+  return m_sLast.m_nAdmitted;
+} //GetAdmitted
+
+/// Reader function for the number of particles thinned out.
+/// \return Number of particles thinned out by downsampling in the last frame.
+
+const size_t CParticleBudget::GetThinned() const{
+  return m_sLast.m_nThinned;
+} //GetThinned
+
+/// Reader function for the number of particles rejected.
+/// \return Number of particles rejected outright in the last frame.
+
+const size_t CParticleBudget::GetRejected() const{
+  return m_sLast.m_nRejected;
+} //GetRejected
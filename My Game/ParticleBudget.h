@@ -0,0 +1,65 @@
+/// \file ParticleBudget.h
+/// \brief Interface for the particle budget CParticleBudget.
+
+#ifndef __L4RC_GAME_PARTICLEBUDGET_H__
+#define __L4RC_GAME_PARTICLEBUDGET_H__
+
+#include "Common.h"
+#include "GameDefines.h"
+
+/// \brief A particle category's share of the budget.
+
+struct SParticleQuota{
+  size_t m_nQuota = 0; ///< Most live particles in the category.
+  UINT m_nPriority = 0; ///< Priority, zero being the highest.
+  size_t m_nLive = 0; ///< Number of live particles in the category.
+}; //SParticleQuota
+
+/// \brief Numbers of particles admitted and turned away.
+
+struct SParticleCounts{
+  size_t m_nAdmitted = 0; ///< Particles admitted.
+  size_t m_nThinned = 0; ///< Particles thinned out by downsampling.
+  size_t m_nRejected = 0; ///< Particles rejected outright.
+}; //SParticleCounts
+
+/// \brief The particle budget.
+///
+/// Decides whether a new particle may be created, given how many particles
+/// are alive in its category and in total, and how far from the camera it
+/// is. Each category has a quota and a priority. A category of lower
+/// priority is held back from the last part of the global budget, leaving
+/// it for categories of higher priority. Once the fuller of the category
+/// and the global budget passes the point where downsampling starts, new
+/// particles are admitted at random with a probability that falls to zero
+/// as the budget runs out, and particles far from the camera are treated as
+/// if the budget were fuller. The numbers of particles admitted, thinned out
+/// by downsampling, and rejected outright are counted per frame.
+
+class CParticleBudget: public CCommon{
+  private:
+    SParticleQuota m_sQuota[(UINT)eParticleCategory::Size]; ///< Category quotas.
+    size_t m_nBudget = 0; ///< Most live particles in total.
+    size_t m_nLive = 0; ///< Number of live particles.
+
+    SParticleCounts m_sCount; ///< Counts so far this frame.
+    SParticleCounts m_sLast; ///< Counts for the last frame.
+
+  public:
+    CParticleBudget(); ///< Constructor.
+
+    void SetBudget(size_t); ///< Set the global budget.
+    void SetQuota(eParticleCategory, size_t, UINT); ///< Set a category's quota and priority.
+
+    const bool Admit(eParticleCategory, float); ///< Decide whether to create a particle.
+    void Remove(eParticleCategory); ///< Note that a particle has died.
+    void BeginFrame(); ///< Start counting a new frame.
+    void clear(); ///< Note that all particles have been removed.
+
+    const float GetUtilisation() const; ///< Get fraction of the budget in use.
+    const size_t GetAdmitted() const; ///< Get particles admitted in the last frame.
+    const size_t GetThinned() const; ///< Get particles thinned out in the last frame.
+    const size_t GetRejected() const; ///< Get particles rejected in the last frame.
+}; //CParticleBudget
+
+#endif //__L4RC_GAME_PARTICLEBUDGET_H__
@@ -0,0 +1,393 @@
+/// \file ParticleStore.cpp
+/// \brief Code for the particle store CParticleStore.
+
+#include <algorithm>
+#include <chrono>
+#include <xmmintrin.h>
+
+#include "ParticleStore.h"
+#include "ComponentIncludes.h"
+
+static const float MIN_FRACTION = 1e-6f; ///< Smallest fraction of life, so that a curve of zero length is already complete.
+static const float MAX_RECIPROCAL = 1e7f; ///< Reciprocal used for a curve of zero length.
+
+/// Reciprocal of a curve fraction.
+/// \param f Fraction of life.
+/// \return 1/f, or a huge number if f is zero.
+
+static inline float Reciprocal(float f){
+  return f > 0.0f? 1.0f/f: MAX_RECIPROCAL;
+} //Reciprocal
+
+/// Evaluate a curve that rises linearly over a fraction of a particle's life,
+/// holds at one, and falls linearly over another fraction at the end.
+/// \param t Fraction of life that has passed.
+/// \param in Reciprocal of the rising fraction.
+/// \param out Reciprocal of the falling fraction.
+/// \return Curve value in [0, 1].
+
+static inline float Curve(float t, float in, float out){
+  return std::max<float>(0.0f, std::min<float>(1.0f, std::min<float>(t*in, (1.0f - t)*out)));
+} //Curve
+
+/// Append a particle to the arrays, with its scale and alpha at birth,
+/// provided that the particle budget admits it. A particle that can't
+/// reach the window in its lifetime is culled before it gets to the budget,
+/// which is cheap because all particles are purely cosmetic.
+/// \param d Particle descriptor.
+/// \param c Budget category.
+/// \param campos Camera position.
+/// \param r Distance from the center of the window to a corner.
+
+void CParticleStore::Append(const LParticleDesc2D& d, eParticleCategory c,
+  const Vector3& campos, float r)
+{
+  const float reach = d.m_fMaxScale*GetHalfSize(d.m_nSpriteIndex) +
+    d.m_vVel.Length()*d.m_fLifeSpan; //how far the particle can be seen from its start
+
+  if(!IsVisible(d.m_vPos, reach)){
+    m_nCulled++;
+    return;
+  } //if
+
+  const float dist = Vector2(d.m_vPos.x - campos.x, d.m_vPos.y - campos.y).Length(); //distance from camera
+
+  if(!m_cBudget.Admit(c, dist/r))
+    return;
+
+  const float inScale = Reciprocal(d.m_fScaleInFrac);
+  const float outScale = Reciprocal(d.m_fScaleOutFrac);
+  const float inFade = Reciprocal(d.m_fFadeInFrac);
+  const float outFade = Reciprocal(d.m_fFadeOutFrac);
+
+  m_vecPosX.push_back(d.m_vPos.x);
+  m_vecPosY.push_back(d.m_vPos.y);
+  m_vecVelX.push_back(d.m_vVel.x);
+  m_vecVelY.push_back(d.m_vVel.y);
+  m_vecAge.push_back(0.0f);
+  m_vecInvLife.push_back(Reciprocal(d.m_fLifeSpan));
+  m_vecInvScaleIn.push_back(inScale);
+  m_vecInvScaleOut.push_back(outScale);
+  m_vecInvFadeIn.push_back(inFade);
+  m_vecInvFadeOut.push_back(outFade);
+  m_vecMaxScale.push_back(d.m_fMaxScale);
+  m_vecMaxAlpha.push_back(d.m_fAlpha);
+  m_vecScale.push_back(d.m_fMaxScale*Curve(MIN_FRACTION, inScale, outScale));
+  m_vecAlpha.push_back(d.m_fAlpha*Curve(MIN_FRACTION, inFade, outFade));
+
+  SParticleLook look;
+  look.m_nSpriteIndex = d.m_nSpriteIndex;
+  look.m_nCurrentFrame = d.m_nCurrentFrame;
+  look.m_fRoll = d.m_fRoll;
+  look.m_f4Tint = d.m_f4Tint;
+  look.m_eCategory = c;
+  m_vecLook.push_back(look);
+} //Append
+
+/// Make room in the arrays for a number of particles, at least doubling
+/// their capacity if they have to grow so that a run of small batches
+/// doesn't reallocate every time.
+/// \param n Number of particles.
+
+void CParticleStore::Reserve(size_t n){
+  if(n <= m_vecPosX.capacity())return; //already room
+
+  n = std::max<size_t>(n, 2*m_vecPosX.capacity());
+
+  for(std::vector<float>* p: {&m_vecPosX, &m_vecPosY, &m_vecVelX, &m_vecVelY,
+    &m_vecAge, &m_vecInvLife, &m_vecInvScaleIn, &m_vecInvScaleOut, &m_vecInvFadeIn,
+    &m_vecInvFadeOut, &m_vecMaxScale, &m_vecMaxAlpha, &m_vecScale, &m_vecAlpha})
+    p->reserve(n);
+
+  m_vecLook.reserve(n);
+} //Reserve
+
+/// Create a particle.
+/// \param d Particle descriptor.
+/// \param c Budget category.
+
+void CParticleStore::create(const LParticleDesc2D& d, eParticleCategory c){
+  const Vector3 campos = m_pRenderer->GetCameraPos(); //camera position
+  const float r = 0.5f*sqrtf((float)m_nWinWidth*m_nWinWidth + (float)m_nWinHeight*m_nWinHeight); //center to corner of window
+  Append(d, c, campos, r);
+} //create
+
+/// Create a batch of particles in the same budget category. The arrays are
+/// grown once for the whole batch and the camera position is read once.
+/// \param d Array of particle descriptors.
+/// \param n Number of particle descriptors.
+/// \param c Budget category.
+
+void CParticleStore::create(const LParticleDesc2D* d, size_t n, eParticleCategory c){
+  const Vector3 campos = m_pRenderer->GetCameraPos(); //camera position
+  const float r = 0.5f*sqrtf((float)m_nWinWidth*m_nWinWidth + (float)m_nWinHeight*m_nWinHeight); //center to corner of window
+  Reserve(GetSize() + n);
+
+  for(size_t i=0; i<n; i++)
+    Append(d[i], c, campos, r);
+} //create
+
+/// Advance every particle by one time step. Four particles are done at a
+/// time with SSE, and any left over are done one at a time with the same
+/// arithmetic. A particle is dead once its age reaches its lifespan, which
+/// leaves its alpha at zero, and is then returned to the budget. Dead particles are compacted away once they
+/// make up a quarter of the store.
+/// \param dt Time step in seconds.
+
+void CParticleStore::step(float dt){
+  const auto start = std::chrono::high_resolution_clock::now(); //start time
+  m_cBudget.BeginFrame();
+  m_nLastCulled = m_nCulled;
+  m_nCulled = 0;
+
+  const size_t n = m_vecAge.size(); //number of particles
+  const size_t n4 = n & ~(size_t)3; //number done with SSE
+
+  float* px = m_vecPosX.data(); float* py = m_vecPosY.data();
+  const float* vx = m_vecVelX.data(); const float* vy = m_vecVelY.data();
+  float* age = m_vecAge.data(); const float* invlife = m_vecInvLife.data();
+  const float* scalein = m_vecInvScaleIn.data(); const float* scaleout = m_vecInvScaleOut.data();
+  const float* fadein = m_vecInvFadeIn.data(); const float* fadeout = m_vecInvFadeOut.data();
+  const float* smax = m_vecMaxScale.data(); const float* amax = m_vecMaxAlpha.data();
+  float* scale = m_vecScale.data(); float* alpha = m_vecAlpha.data();
+
+  const __m128 vdt = _mm_set1_ps(dt);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 tmin = _mm_set1_ps(MIN_FRACTION);
+
+  static const UINT nBits[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4}; //bits set in a nibble
+  size_t dead = 0; //number of dead particles
+
+  for(size_t i=0; i<n4; i+=4){
+    _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(vx + i), vdt)));
+    _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(vy + i), vdt)));
+
+    const __m128 a0 = _mm_loadu_ps(age + i); //old age
+    const __m128 a = _mm_add_ps(a0, vdt); //new age
+    _mm_storeu_ps(age + i, a);
+
+    const __m128 il = _mm_loadu_ps(invlife + i); //reciprocal of lifespan
+    const __m128 t = _mm_max_ps(tmin, _mm_mul_ps(a, il)); //fraction of life
+    const __m128 u = _mm_sub_ps(one, t); //fraction of life left
+
+    __m128 c = _mm_min_ps(_mm_mul_ps(t, _mm_loadu_ps(scalein + i)), _mm_mul_ps(u, _mm_loadu_ps(scaleout + i)));
+    c = _mm_max_ps(zero, _mm_min_ps(one, c)); //scale curve
+    _mm_storeu_ps(scale + i, _mm_mul_ps(c, _mm_loadu_ps(smax + i)));
+
+    c = _mm_min_ps(_mm_mul_ps(t, _mm_loadu_ps(fadein + i)), _mm_mul_ps(u, _mm_loadu_ps(fadeout + i)));
+    c = _mm_max_ps(zero, _mm_min_ps(one, c)); //fade curve
+    _mm_storeu_ps(alpha + i, _mm_mul_ps(c, _mm_loadu_ps(amax + i)));
+
+    const int nDead = _mm_movemask_ps(_mm_cmpge_ps(t, one)); //dead now
+    const int nWasDead = _mm_movemask_ps(_mm_cmpge_ps(_mm_max_ps(tmin, _mm_mul_ps(a0, il)), one)); //dead before
+    dead += nBits[nDead];
+
+    if(nDead != nWasDead) //died in this step
+      for(UINT j=0; j<4; j++)
+        if(((nDead & ~nWasDead) >> j) & 1)
+          m_cBudget.Remove(m_vecLook[i + j].m_eCategory);
+  } //for
+
+  for(size_t i=n4; i<n; i++){ //the rest
+    px[i] += vx[i]*dt;
+    py[i] += vy[i]*dt;
+    const bool bWasDead = std::max<float>(MIN_FRACTION, age[i]*invlife[i]) >= 1.0f; //dead before
+    age[i] += dt;
+
+    const float t = std::max<float>(MIN_FRACTION, age[i]*invlife[i]); //fraction of life
+    scale[i] = smax[i]*Curve(t, scalein[i], scaleout[i]);
+    alpha[i] = amax[i]*Curve(t, fadein[i], fadeout[i]);
+
+    if(t >= 1.0f){
+      dead++;
+      if(!bWasDead)m_cBudget.Remove(m_vecLook[i].m_eCategory);
+    } //if
+  } //for
+
+  m_nDead = dead;
+
+  if(4*m_nDead >= n && m_nDead > 0)
+    Compact();
+
+  const std::chrono::duration<float, std::milli> ms =
+      std::chrono::high_resolution_clock::now() - start; //time taken
+  m_fStepTime = ms.count();
+} //step
+
+/// Remove the dead particles in one pass, keeping the live ones in the
+/// order they were created so that newer particles are still drawn over
+/// older ones.
+
+void CParticleStore::Compact(){
+  const size_t n = m_vecAge.size(); //number of particles
+  size_t k = 0; //number of live particles so far
+
+  for(size_t i=0; i<n; i++){
+    if(std::max<float>(MIN_FRACTION, m_vecAge[i]*m_vecInvLife[i]) >= 1.0f)
+      continue; //dead
+
+    if(k < i){ //move down
+      m_vecPosX[k] = m_vecPosX[i];
+      m_vecPosY[k] = m_vecPosY[i];
+      m_vecVelX[k] = m_vecVelX[i];
+      m_vecVelY[k] = m_vecVelY[i];
+      m_vecAge[k] = m_vecAge[i];
+      m_vecInvLife[k] = m_vecInvLife[i];
+      m_vecInvScaleIn[k] = m_vecInvScaleIn[i];
+      m_vecInvScaleOut[k] = m_vecInvScaleOut[i];
+      m_vecInvFadeIn[k] = m_vecInvFadeIn[i];
+      m_vecInvFadeOut[k] = m_vecInvFadeOut[i];
+      m_vecMaxScale[k] = m_vecMaxScale[i];
+      m_vecMaxAlpha[k] = m_vecMaxAlpha[i];
+      m_vecScale[k] = m_vecScale[i];
+      m_vecAlpha[k] = m_vecAlpha[i];
+      m_vecLook[k] = m_vecLook[i];
+    } //if
+
+    k++;
+  } //for
+
+  m_vecPosX.resize(k);
+  m_vecPosY.resize(k);
+  m_vecVelX.resize(k);
+  m_vecVelY.resize(k);
+  m_vecAge.resize(k);
+  m_vecInvLife.resize(k);
+  m_vecInvScaleIn.resize(k);
+  m_vecInvScaleOut.resize(k);
+  m_vecInvFadeIn.resize(k);
+  m_vecInvFadeOut.resize(k);
+  m_vecMaxScale.resize(k);
+  m_vecMaxAlpha.resize(k);
+  m_vecScale.resize(k);
+  m_vecAlpha.resize(k);
+  m_vecLook.resize(k);
+
+  m_nDead = 0;
+} //Compact
+
+/// Get half of the larger of a sprite's width and height, which bounds the
+/// sprite at unit scale. The size of each sprite is asked of the renderer
+/// only once.
+/// \param n Sprite index.
+/// \return Half the sprite's size.
+
+const float CParticleStore::GetHalfSize(UINT n){
+  if(n >= m_vecHalfSize.size())
+    m_vecHalfSize.resize(n + 1, -1.0f);
+
+  if(m_vecHalfSize[n] < 0.0f){ //first time
+    const float w = m_pRenderer->GetWidth(n);
+    const float h = m_pRenderer->GetHeight(n);
+    m_vecHalfSize[n] = 0.5f*std::max<float>(w, h);
+  } //if
+
+  return m_vecHalfSize[n];
+} //GetHalfSize
+
+/// Determine whether a circle overlaps the window.
+/// \param pos Center of circle.
+/// \param r Radius of circle.
+/// \return true if the circle overlaps the window.
+
+const bool CParticleStore::IsVisible(const Vector2& pos, float r) const{
+  const Vector3 campos = m_pRenderer->GetCameraPos(); //camera position
+
+  return fabsf(pos.x - campos.x) <= 0.5f*m_nWinWidth + r &&
+    fabsf(pos.y - campos.y) <= 0.5f*m_nWinHeight + r;
+} //IsVisible
+
+/// Draw the particles that are alive, not completely transparent or shrunk
+/// to nothing, and overlap the window.
+
+void CParticleStore::Draw(){
+  const Vector3 campos = m_pRenderer->GetCameraPos(); //camera position
+  const float w = 0.5f*m_nWinWidth; //half window width
+  const float h = 0.5f*m_nWinHeight; //half window height
+
+  LSpriteDesc2D desc; //sprite descriptor
+  m_nDrawn = 0;
+
+  for(size_t i=0; i<m_vecAlpha.size(); i++){
+    const float s = m_vecScale[i]; //scale
+
+    if(m_vecAlpha[i] <= 0.0f || s <= 0.0f)
+      continue; //dead or invisible
+
+    const SParticleLook& look = m_vecLook[i];
+    const float r = s*GetHalfSize(look.m_nSpriteIndex); //bounding radius
+
+    if(fabsf(m_vecPosX[i] - campos.x) > w + r || fabsf(m_vecPosY[i] - campos.y) > h + r)
+      continue; //off screen
+
+    desc.m_nSpriteIndex = look.m_nSpriteIndex;
+    desc.m_nCurrentFrame = look.m_nCurrentFrame;
+    desc.m_vPos = Vector2(m_vecPosX[i], m_vecPosY[i]);
+    desc.m_fRoll = look.m_fRoll;
+    desc.m_f4Tint = look.m_f4Tint;
+    desc.m_fAlpha = m_vecAlpha[i];
+    desc.m_fXScale = desc.m_fYScale = s;
+
+    m_pRenderer->Draw(&desc);
+    m_nDrawn++;
+  } //for
+} //Draw
+
+/// Remove all particles.
+
+void CParticleStore::clear(){
+  m_vecPosX.clear();
+  m_vecPosY.clear();
+  m_vecVelX.clear();
+  m_vecVelY.clear();
+  m_vecAge.clear();
+  m_vecInvLife.clear();
+  m_vecInvScaleIn.clear();
+  m_vecInvScaleOut.clear();
+  m_vecInvFadeIn.clear();
+  m_vecInvFadeOut.clear();
+  m_vecMaxScale.clear();
+  m_vecMaxAlpha.clear();
+  m_vecScale.clear();
+  m_vecAlpha.clear();
+  m_vecLook.clear();
+
+  m_nDead = 0;
+  m_cBudget.clear();
+} //clear
+
+/// Reader function for the particle budget, which can be tuned through it.
+/// \return Reference to the particle budget.
+
+CParticleBudget& CParticleStore::GetBudget(){
+  return m_cBudget;
+} //GetBudget
+
+/// Reader function for the number of particles.
+/// \return Number of particles, including dead ones not yet compacted.
+
+const size_t CParticleStore::GetSize() const{
+  return m_vecAge.size();
+} //GetSize
+
+/// Reader function for the number of particles drawn.
+/// \return Number of particles drawn in the last frame.
+
+const size_t CParticleStore::GetNumDrawn() const{
+  return m_nDrawn;
+} //GetNumDrawn
+
+/// Reader function for the number of particles culled.
+/// \return Number of particles culled for being out of sight in the last frame.
+
+const size_t CParticleStore::GetNumCulled() const{
+  return m_nLastCulled;
+} //GetNumCulled
+
+/// Reader function for the step time.
+/// \return CPU time taken by the last step in milliseconds.
+
+const float CParticleStore::GetStepTime() const{
+  return m_fStepTime;
+} //GetStepTime
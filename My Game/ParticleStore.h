@@ -0,0 +1,96 @@
+/// \file ParticleStore.h
+/// \brief Interface for the particle store CParticleStore.
+
+#ifndef __L4RC_GAME_PARTICLESTORE_H__
+#define __L4RC_GAME_PARTICLESTORE_H__
+
+#include <vector>
+
+#include "Common.h"
+#include "Component.h"
+#include "Settings.h"
+#include "Particle.h"
+#include "ParticleBudget.h"
+
+/// \brief How a particle is drawn.
+///
+/// The parts of a particle that the simulation doesn't touch, kept apart
+/// from the arrays that it streams through.
+
+struct SParticleLook{
+  UINT m_nSpriteIndex = 0; ///< Sprite index.
+  UINT m_nCurrentFrame = 0; ///< Frame number.
+  float m_fRoll = 0.0f; ///< Orientation.
+  XMFLOAT4 m_f4Tint; ///< Tint.
+  eParticleCategory m_eCategory = eParticleCategory::Combat; ///< Budget category.
+}; //SParticleLook
+
+/// \brief Structure-of-arrays particle system.
+///
+/// A replacement for `LParticleEngine2D` that keeps the properties that
+/// change every frame in parallel arrays, so that `step()` can advance
+/// four particles at a time with SSE. Each step integrates position,
+/// ages the particles, and evaluates the scale-in, scale-out, fade-in and
+/// fade-out curves from the fraction of the particle's life that has
+/// passed. Reciprocals of the lifespan and curve fractions are taken once
+/// when a particle is created, so the step does no division. Dead
+/// particles are left in place, invisible, until enough of them build up
+/// to be worth compacting away in one pass. `Draw()` hands the renderer
+/// only the live particles that overlap the window. New particles are
+/// created only if they can be seen at some point in their lives and the
+/// particle budget admits them.
+
+class CParticleStore:
+  public CCommon,
+  public LComponent,
+  public LSettings
+{
+  private:
+    std::vector<float> m_vecPosX; ///< Position x coordinates.
+    std::vector<float> m_vecPosY; ///< Position y coordinates.
+    std::vector<float> m_vecVelX; ///< Velocity x coordinates.
+    std::vector<float> m_vecVelY; ///< Velocity y coordinates.
+    std::vector<float> m_vecAge; ///< Time since creation.
+    std::vector<float> m_vecInvLife; ///< Reciprocal of lifespan.
+    std::vector<float> m_vecInvScaleIn; ///< Reciprocal of scale-in fraction.
+    std::vector<float> m_vecInvScaleOut; ///< Reciprocal of scale-out fraction.
+    std::vector<float> m_vecInvFadeIn; ///< Reciprocal of fade-in fraction.
+    std::vector<float> m_vecInvFadeOut; ///< Reciprocal of fade-out fraction.
+    std::vector<float> m_vecMaxScale; ///< Maximum scale.
+    std::vector<float> m_vecMaxAlpha; ///< Maximum alpha.
+    std::vector<float> m_vecScale; ///< Current scale.
+    std::vector<float> m_vecAlpha; ///< Current alpha.
+    std::vector<SParticleLook> m_vecLook; ///< How each particle is drawn.
+
+    CParticleBudget m_cBudget; ///< Particle budget.
+    std::vector<float> m_vecHalfSize; ///< Half the larger sprite dimension, by sprite index.
+
+    size_t m_nDead = 0; ///< Number of dead particles not yet compacted.
+    size_t m_nDrawn = 0; ///< Number of particles drawn in the last frame.
+    size_t m_nCulled = 0; ///< Number of particles culled so far this frame.
+    size_t m_nLastCulled = 0; ///< Number of particles culled in the last frame.
+    float m_fStepTime = 0.0f; ///< CPU time of the last step in milliseconds.
+
+    void Append(const LParticleDesc2D&, eParticleCategory,
+      const Vector3&, float); ///< Append a particle if it can be seen and is admitted.
+    void Reserve(size_t); ///< Make room for particles.
+    void Compact(); ///< Remove dead particles.
+    const float GetHalfSize(UINT); ///< Get half of a sprite's size.
+
+  public:
+    void create(const LParticleDesc2D&, eParticleCategory); ///< Create a particle.
+    void create(const LParticleDesc2D*, size_t, eParticleCategory); ///< Create a batch of particles.
+    void step(float); ///< Advance the particles.
+    void Draw(); ///< Draw the visible particles.
+    void clear(); ///< Remove all particles.
+
+    const bool IsVisible(const Vector2&, float) const; ///< Whether a circle overlaps the window.
+
+    CParticleBudget& GetBudget(); ///< Get the particle budget.
+    const size_t GetSize() const; ///< Get number of particles, including dead ones.
+    const size_t GetNumDrawn() const; ///< Get number of particles drawn.
+    const size_t GetNumCulled() const; ///< Get number of particles culled.
+    const float GetStepTime() const; ///< Get step time.
+}; //CParticleStore
+
+#endif //__L4RC_GAME_PARTICLESTORE_H__
@@ -0,0 +1,58 @@
+/// \file PeriodicTimer.cpp
+/// \brief Code for the periodic timer CPeriodicTimer.
+
+#include <type_traits>
+
+#include "PeriodicTimer.h"
+#include "ComponentIncludes.h"
+
+static_assert(std::is_trivially_copyable<CPeriodicTimer>::value,
+  "CPeriodicTimer must be trivially copyable");
+
+/// Start the timer, or restart it if it is already running. The first event
+/// happens one period from now, plus a random extra delay.
+/// \param t Period in seconds.
+/// \param dt Maximum random extra delay in seconds, defaults to zero.
+
+void CPeriodicTimer::Start(float t, float dt){
+  m_fPeriod = t;
+  m_fMaxDelta = dt;
+  m_fNextTime = m_pTimer->GetTime() + m_fPeriod + m_fMaxDelta*m_cAIRandom.randf();
+  m_bRunning = true;
+} //Start
+
+/// Stop the timer so that it no longer triggers.
+
+void CPeriodicTimer::Stop(){
+  m_bRunning = false;
+} //Stop
+
+/// Change the period. The event that is already pending moves by the
+/// change in period.
+/// \param t New period in seconds.
+
+void CPeriodicTimer::SetDelay(float t){
+  m_fNextTime += t - m_fPeriod;
+  m_fPeriod = t;
+} //SetDelay
+
+/// Test whether the timer is running and its next event is due. If so, then
+/// schedule the one after it.
+/// \return true if an event is due.
+
+const bool CPeriodicTimer::Triggered(){
+  const float t = m_pTimer->GetTime(); //current time
+
+  if(!m_bRunning || t < m_fNextTime)
+    return false;
+
+  m_fNextTime = t + m_fPeriod + m_fMaxDelta*m_cAIRandom.randf();
+  return true;
+} //Triggered
+
+/// Reader function for whether the timer is running.
+/// \return true if the timer has been started and not stopped.
+
+const bool CPeriodicTimer::IsRunning() const{
+  return m_bRunning;
+} //IsRunning
@@ -0,0 +1,42 @@
+/// \file PeriodicTimer.h
+/// \brief Interface for the periodic timer CPeriodicTimer.
+
+#ifndef __L4RC_GAME_PERIODICTIMER_H__
+#define __L4RC_GAME_PERIODICTIMER_H__
+
+#include "Component.h"
+#include "Common.h"
+
+/// \brief A periodic timer stored by value.
+///
+/// A replacement for `LEventTimer` that can be embedded in an object instead
+/// of being allocated on the heap. It is trivially copyable and holds only a
+/// period, an optional random extra delay, the time of the next event, and
+/// whether it is running, so starting and stopping it on every change of
+/// animation state costs no allocations. `Triggered()` behaves the same way
+/// as `LEventTimer::Triggered()`, except that a stopped timer never triggers.
+/// The random extra delay comes from the gameplay random number stream, so
+/// it is reproduced along with the rest of the gameplay from the seed.
+
+class CPeriodicTimer:
+  public LComponent,
+  public CCommon
+{
+  private:
+    float m_fPeriod = 0.0f; ///< Time between events.
+    float m_fMaxDelta = 0.0f; ///< Maximum random extra delay.
+    float m_fNextTime = 0.0f; ///< Time of the next event.
+    bool m_bRunning = false; ///< Whether the timer is running.
+
+  public:
+    CPeriodicTimer() = default; ///< Constructor.
+
+    void Start(float, float=0.0f); ///< Start the timer.
+    void Stop(); ///< Stop the timer.
+    void SetDelay(float); ///< Change the period.
+
+    const bool Triggered(); ///< Test whether an event is due.
+    const bool IsRunning() const; ///< Whether the timer is running.
+}; //CPeriodicTimer
+
+#endif //__L4RC_GAME_PERIODICTIMER_H__
@@ -0,0 +1,82 @@
+/// \file PhysicsStore.cpp
+/// \brief Code for the physics store CPhysicsStore.
+
+#include "PhysicsStore.h"
+
+/// Allocate a slot for an object, reusing a free slot if there is one.
+/// The slot's data is zeroed except for the `LIVE` flag.
+/// \param pObj Pointer to the object.
+/// \return Slot number.
+
+const UINT CPhysicsStore::Alloc(CObject* pObj){
+  UINT n = 0; //slot number
+
+  if(m_vecFree.empty()){ //grow
+    n = (UINT)m_vecFlags.size();
+    m_vecPosX.push_back(0.0f);
+    m_vecPosY.push_back(0.0f);
+    m_vecVelX.push_back(0.0f);
+    m_vecVelY.push_back(0.0f);
+    m_vecRadius.push_back(0.0f);
+    m_vecFlags.push_back(0);
+    m_vecObject.push_back(nullptr);
+  } //if
+
+  else{ //recycle
+    n = m_vecFree.back();
+    m_vecFree.pop_back();
+  } //else
+
+  m_vecPosX[n] = m_vecPosY[n] = 0.0f;
+  m_vecVelX[n] = m_vecVelY[n] = 0.0f;
+  m_vecRadius[n] = 0.0f;
+  m_vecFlags[n] = LIVE;
+  m_vecObject[n] = pObj;
+
+  return n;
+} //Alloc
+
+/// Free a slot so that it can be reused.
+/// \param n Slot number.
+
+void CPhysicsStore::Free(UINT n){
+  m_vecFlags[n] = 0;
+  m_vecObject[n] = nullptr;
+  m_vecFree.push_back(n);
+} //Free
+
+/// Free all slots and release the memory used by the arrays.
+
+void CPhysicsStore::clear(){
+  m_vecPosX.clear();
+  m_vecPosY.clear();
+  m_vecVelX.clear();
+  m_vecVelY.clear();
+  m_vecRadius.clear();
+  m_vecFlags.clear();
+  m_vecObject.clear();
+  m_vecFree.clear();
+} //clear
+
+/// Move every live, non-static, non-dead slot that has the `INTEGRATE` flag
+/// an amount that depends on its velocity and the frame time. The loop has
+/// no branches so that the compiler can vectorize it.
+/// \param t Frame time.
+
+void CPhysicsStore::Integrate(float t){
+  const UINT8 mask = LIVE | STATIC | DEAD | INTEGRATE; //flags that matter
+  const size_t n = m_vecFlags.size(); //number of slots
+
+  for(size_t i=0; i<n; i++){
+    const float dt = (m_vecFlags[i] & mask) == (LIVE | INTEGRATE)? t: 0.0f;
+    m_vecPosX[i] += m_vecVelX[i]*dt;
+    m_vecPosY[i] += m_vecVelY[i]*dt;
+  } //for
+} //Integrate
+
+/// Reader function for the number of slots.
+/// \return Number of slots, including free ones.
+
+const size_t CPhysicsStore::GetSize() const{
+  return m_vecFlags.size();
+} //GetSize
@@ -0,0 +1,60 @@
+/// \file PhysicsStore.h
+/// \brief Interface for the physics store CPhysicsStore.
+
+#ifndef __L4RC_GAME_PHYSICSSTORE_H__
+#define __L4RC_GAME_PHYSICSSTORE_H__
+
+#include <vector>
+
+#include "Defines.h"
+
+class CObject;
+
+/// \brief Structure-of-arrays physics data.
+///
+/// Position, velocity, radius and flags for the objects in the object list,
+/// kept in parallel arrays indexed by a slot number so that integration and
+/// overlap tests can stream through memory instead of chasing pointers.
+/// A slot stays with its object for the object's lifetime and is recycled
+/// through a free list when the object is culled. `LBaseObject` still owns
+/// the object's position, so the object manager gathers into the store once
+/// per tick and scatters integrated positions back.
+
+class CPhysicsStore{
+  friend class CObjectManager; ///< Object manager streams through the arrays.
+
+  public:
+    /// \brief Bits in the flags array.
+
+    enum : UINT8{
+      LIVE      = 1, ///< Slot is in use.
+      STATIC    = 2, ///< Object does not move.
+      DEAD      = 4, ///< Object is marked for deletion.
+      TARGET    = 8, ///< Object is a target.
+      INTEGRATE = 16, ///< Position is integrated by the store.
+      FIXED     = 32 ///< Object is in the static broad phase grid.
+    }; //enum
+
+    static const UINT NONE = 0xFFFFFFFF; ///< Slot number for no slot.
+
+  private:
+    std::vector<float> m_vecPosX; ///< Position x coordinates.
+    std::vector<float> m_vecPosY; ///< Position y coordinates.
+    std::vector<float> m_vecVelX; ///< Velocity x coordinates.
+    std::vector<float> m_vecVelY; ///< Velocity y coordinates.
+    std::vector<float> m_vecRadius; ///< Bounding circle radii.
+    std::vector<UINT8> m_vecFlags; ///< Flags.
+    std::vector<CObject*> m_vecObject; ///< Object in each slot.
+    std::vector<UINT> m_vecFree; ///< Free slots.
+
+  public:
+    const UINT Alloc(CObject*); ///< Allocate a slot.
+    void Free(UINT); ///< Free a slot.
+    void clear(); ///< Free all slots.
+
+    void Integrate(float); ///< Integrate positions.
+
+    const size_t GetSize() const; ///< Get number of slots, including free ones.
+}; //CPhysicsStore
+
+#endif //__L4RC_GAME_PHYSICSSTORE_H__
@@ -5,9 +5,10 @@
 #include "ComponentIncludes.h"
 #include "Helpers.h"
 #include "Particle.h"
-#include "ParticleEngine.h"
+#include "ParticleStore.h"
 #include "SpriteRenderer.h"
 #include "Obstacle.h"
+#include "EmitterManager.h"
 
  ///Create and initialize an player object given its initial position.
  ///\param p Initial position of player.
@@ -16,11 +17,12 @@ CPlayer::CPlayer(const Vector2& p) : CObject(eSprite::PlayerIdleDown, p) {
 
   m_bIsTarget = true; //Can be hit
   m_bStatic = false;
+  m_bIntegrate = false; //moves itself
 
   m_fRoll = 0.0f;
   m_fXScale = m_fYScale = 2.0f; //Scale player sprite to look right
 
-  m_pIdleEvent = new LEventTimer(0.2f);
+  m_cIdleEvent.Start(0.2f);
 
   m_nStatusEff = -1;
 
@@ -38,26 +40,6 @@ int CPlayer::GetPort() {
 
 /// Destructor
 CPlayer::~CPlayer() {
-  if (m_pIdleEvent) {
-    delete m_pIdleEvent;
-    m_pIdleEvent = nullptr;
-  }
-  if (m_pDeathEvent) {
-    delete m_pDeathEvent;
-    m_pDeathEvent = nullptr;
-  }
-  if (m_pRunEvent) {
-    delete m_pRunEvent;
-    m_pRunEvent = nullptr;
-  }
-  if (m_pDashEvent) {
-    delete m_pDashEvent;
-    m_pDashEvent = nullptr;
-  }
-  if (m_pDamageEvent) {
-    delete m_pDamageEvent;
-    m_pDamageEvent = nullptr;
-  }
 } //Destructor
 
 /// Move Player to device input. The amount of motion is proportional to the frame time
@@ -123,9 +105,9 @@ void CPlayer::ShakeTimer() {
     m_nShakeTimer += delta;
     
     if (m_nShakeTimer != 0 && m_nShakeTimer % 10 == 0) {
-      UINT dx = m_pRandom->randn(1, 10);
-      UINT dy = m_pRandom->randn(1, 10);
-      UINT choice = m_pRandom->randn(0, 4);
+      UINT dx = m_cEffectsRandom.randn(1, 10);
+      UINT dy = m_cEffectsRandom.randn(1, 10);
+      UINT choice = m_cEffectsRandom.randn(0, 4);
       switch (choice) {
       case 1: {
         m_pRenderer->SetCameraPos(Vector3(m_pRenderer->GetCameraPos().x + dx, m_pRenderer->GetCameraPos().y + dy, 0.0f));
@@ -142,10 +124,10 @@ void CPlayer::ShakeTimer() {
       }
     }
     else if (m_nShakeTimer % 5 == 0) {
-      m_pRenderer->SetCameraPos(Vector3(m_pPlayer->m_vPos.x, m_pPlayer->m_vPos.y, 0.0f));
+      m_pRenderer->SetCameraPos(Vector3(m_hPlayer->m_vPos.x, m_hPlayer->m_vPos.y, 0.0f));
     }
     else {
-      m_pRenderer->SetCameraPos(Vector3(m_pPlayer->m_vPos.x, m_pPlayer->m_vPos.y, 0.0f));
+      m_pRenderer->SetCameraPos(Vector3(m_hPlayer->m_vPos.x, m_hPlayer->m_vPos.y, 0.0f));
     }
     if (m_nShakeTimer >= 21) {
       m_nShakeTimer = 0;
@@ -154,28 +136,16 @@ void CPlayer::ShakeTimer() {
   }
 }
 
-/// Function to delete all other event timers, set idle event timer, change animation state to idle, then change animation depending on last animation direction
+/// Function to stop all other event timers, set idle event timer, change animation state to idle, then change animation depending on last animation direction
 
 void CPlayer::Idle() {
 
-  if (!m_pIdleEvent) {
-    if (m_pRunEvent) {
-      delete m_pRunEvent;
-      m_pRunEvent = nullptr;
-    }
-    if (m_pSwordAttackEvent) {
-      delete m_pSwordAttackEvent;
-      m_pSwordAttackEvent = nullptr;
-    }
-    if (m_pDashEvent) {
-      delete m_pDashEvent;
-      m_pDashEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pIdleEvent = new LEventTimer(0.2f);
+  if (!m_cIdleEvent.IsRunning()) {
+    m_cRunEvent.Stop();
+    m_cSwordAttackEvent.Stop();
+    m_cDashEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cIdleEvent.Start(0.2f);
   }
 
   if (state == ePlayerAnimationState::IDLE) {
@@ -308,27 +278,15 @@ void CPlayer::StrafeUp() {
   }
 } //StrafeUp
 
-/// Function to delete all other event timers, set run event timer, then calculate movement direction based on vectors. Also calls runFX to make dust
+/// Function to stop all other event timers, set run event timer, then calculate movement direction based on vectors. Also calls runFX to make dust
 
 void CPlayer::Run() {
-  if (!m_pRunEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pSwordAttackEvent) {
-      delete m_pSwordAttackEvent;
-      m_pSwordAttackEvent = nullptr;
-    }
-    if (m_pDashEvent) {
-      delete m_pDashEvent;
-      m_pDashEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pRunEvent = new LEventTimer(0.12f);
+  if (!m_cRunEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
+    m_cSwordAttackEvent.Stop();
+    m_cDashEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cRunEvent.Start(0.12f);
   }
 
   Vector2 input_dir = Vector2(m_bStrafeRight - m_bStrafeLeft, m_bStrafeUp - m_bStrafeDown);
@@ -351,7 +309,7 @@ void CPlayer::Run() {
   m_bStrafeLeft = m_bStrafeRight = m_bStrafeDown = m_bStrafeUp = false; //reset strafe flags
 } //Run
 
-/// Function called when space pressed. Sets animation state to attack, attack boolean to true, stops the player, deletes all other event timers
+/// Function called when space pressed. Sets animation state to attack, attack boolean to true, stops the player, stops all other event timers
 /// and sets the sword attack event timer
 
 void CPlayer::AttackTrigger() {
@@ -361,24 +319,12 @@ void CPlayer::AttackTrigger() {
     m_vVelocity = Vector2(0.0f, 0.0f); //Prevents bullet from gaining speed during dash
   }
 
-  if (!m_pSwordAttackEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pRunEvent) {
-      delete m_pRunEvent;
-      m_pRunEvent = nullptr;
-    }
-    if (m_pDashEvent) {
-      delete m_pDashEvent;
-      m_pDashEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pSwordAttackEvent = new LEventTimer(0.08f);
+  if (!m_cSwordAttackEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
+    m_cRunEvent.Stop();
+    m_cDashEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cSwordAttackEvent.Start(0.08f);
   }
 } //AttackTrigger
 
@@ -413,7 +359,7 @@ void CPlayer::Attack() {
   }
 } //Attack
 
-/// Dash trigger function called by shift key press. Sets animation state to dash, deletes all other event timers and sets dash event timer
+/// Dash trigger function called by shift key press. Sets animation state to dash, stops all other event timers and sets dash event timer
 
 void CPlayer::DashTrigger() {
   if (state != ePlayerAnimationState::ATTACK && state != ePlayerAnimationState::DEATH && !m_bDead) {
@@ -423,24 +369,12 @@ void CPlayer::DashTrigger() {
   else
     return;
 
-  if (!m_pDashEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pRunEvent) {
-      delete m_pRunEvent;
-      m_pRunEvent = nullptr;
-    }
-    if (m_pSwordAttackEvent) {
-      delete m_pSwordAttackEvent;
-      m_pSwordAttackEvent = nullptr;
-    }
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    m_pDashEvent = new LEventTimer(0.04f);
+  if (!m_cDashEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
+    m_cRunEvent.Stop();
+    m_cSwordAttackEvent.Stop();
+    m_cIdleEvent.Stop();
+    m_cDashEvent.Start(0.04f);
   }
 } //DashTrigger
 
@@ -509,13 +443,13 @@ void CPlayer::DashFX() {
   d.m_fAlpha = 0.1f;
   d.m_vPos = m_vPos; //center particle at player center
   if (d.m_nSpriteIndex) {
-    m_pParticleEngine->create(d);
+    m_pParticleStore->create(d, eParticleCategory::Trail);
   }
 
 } //DashFX
 
 /// Function called when taking damage to set the player animation state to hurt and boolean taking damage to true
-/// also deletes all other event timers and sets a damage event timer
+/// also stops all other event timers and sets a damage event timer
 
 void CPlayer::DamageTrigger() {
   if (state != ePlayerAnimationState::DEATH && !m_bDead) {
@@ -527,24 +461,12 @@ void CPlayer::DamageTrigger() {
   else
     return;
 
-  if (!m_pDamageEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pRunEvent) {
-      delete m_pRunEvent;
-      m_pRunEvent = nullptr;
-    }
-    if (m_pSwordAttackEvent) {
-      delete m_pSwordAttackEvent;
-      m_pSwordAttackEvent = nullptr;
-    }
-    if (m_pDashEvent) {
-      delete m_pDashEvent;
-      m_pDashEvent = nullptr;
-    }
-    m_pDamageEvent = new LEventTimer(0.06f);
+  if (!m_cDamageEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
+    m_cRunEvent.Stop();
+    m_cSwordAttackEvent.Stop();
+    m_cDashEvent.Stop();
+    m_cDamageEvent.Start(0.06f);
   }
 } //DamageTrigger
 
@@ -589,7 +511,7 @@ void CPlayer::knockback() {
   m_vPos += m_vVelocity * t;
 } //knockback
 
-/// Death trigger function to set animation state to death, delete all other event timers, and set death event timer
+/// Death trigger function to set animation state to death, stop all other event timers, and set death event timer
 
 void CPlayer::DeathTrigger() {
   if (state != ePlayerAnimationState::DEATH) {
@@ -597,28 +519,13 @@ void CPlayer::DeathTrigger() {
   }
   else
     return;
-  if (!m_pDeathEvent) {
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pRunEvent) {
-      delete m_pRunEvent;
-      m_pRunEvent = nullptr;
-    }
-    if (m_pSwordAttackEvent) {
-      delete m_pSwordAttackEvent;
-      m_pSwordAttackEvent = nullptr;
-    }
-    if (m_pDashEvent) {
-      delete m_pDashEvent;
-      m_pDashEvent = nullptr;
-    }
-    m_pDeathEvent = new LEventTimer(0.12f);
+  if (!m_cDeathEvent.IsRunning()) {
+    m_cDamageEvent.Stop();
+    m_cIdleEvent.Stop();
+    m_cRunEvent.Stop();
+    m_cSwordAttackEvent.Stop();
+    m_cDashEvent.Stop();
+    m_cDeathEvent.Start(0.12f);
   }
 } //death
 
@@ -673,7 +580,7 @@ void CPlayer::Death() {
 /// which means collision with a wall).
 
 void CPlayer::CollisionResponse(const Vector2& norm, float d, CObject* pObj) {
-  if (m_bDead || m_pDeathEvent)
+  if (m_bDead || m_cDeathEvent.IsRunning())
     return; //Already dead, bail out
   else if (pObj)
   {
@@ -760,13 +667,13 @@ void CPlayer::CollisionResponse(const Vector2& norm, float d, CObject* pObj) {
 void CPlayer::UpdateFramenumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
   if (state != ePlayerAnimationState::DEATH) {
-    if (n > 1 && m_pRunEvent && m_pRunEvent->Triggered()) {
+    if (n > 1 && m_cRunEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     }
-    else if (n > 1 && m_pIdleEvent && m_pIdleEvent->Triggered()) {
+    else if (n > 1 && m_cIdleEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     }
-    else if (n > 1 && m_pSwordAttackEvent && m_pSwordAttackEvent->Triggered()) {
+    else if (n > 1 && m_cSwordAttackEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bIsAttacking = false;
@@ -775,7 +682,7 @@ void CPlayer::UpdateFramenumber() {
         Idle();
       }
     }
-    else if (n > 1 && m_pDashEvent && m_pDashEvent->Triggered()) {
+    else if (n > 1 && m_cDashEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bIsDashing = false;
@@ -783,7 +690,7 @@ void CPlayer::UpdateFramenumber() {
         Idle();
       }
     }
-    if (n > 1 && m_pDamageEvent && m_pDamageEvent->Triggered()) {
+    if (n > 1 && m_cDamageEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bIsDashing = false;
@@ -794,12 +701,12 @@ void CPlayer::UpdateFramenumber() {
       }
     }
   }
-  else if (n > 1 && m_pDeathEvent && m_pDeathEvent->Triggered() && state == ePlayerAnimationState::DEATH) {
+  else if (n > 1 && m_cDeathEvent.Triggered() && state == ePlayerAnimationState::DEATH) {
     m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     if (m_nCurrentFrame == n - 1) {
       m_bStatic = true;
       m_bDead = true;
-      m_pPlayer = nullptr; //clear common player pointer
+      m_hPlayer = nullptr; //clear common player handle
     }
   }
 } //UpdateFramenumber
@@ -878,209 +785,27 @@ const void CPlayer::StatusEffect() {
 
 /// Applies heal effect visuals to the player
 void CPlayer::HealFx() {
-  const int count = m_pRandom->randn(2, 5); //gen 2-5 particles each call
-  UINT randSize, randColor; //random vars
-  LParticleDesc2D heal;   //particle descriptor
-  for (int i = 0; i < count; i++) {
-    heal.m_nSpriteIndex = (UINT)eSprite::Cross;
-
-    //fade properties
-    heal.m_fLifeSpan = 1.0f;
-    heal.m_fFadeOutFrac = 0.4f;
-    heal.m_fFadeInFrac = 0.1f;
-
-    heal.m_f4Tint = XMFLOAT4(Colors::Green);
-
-    //get random position within the player sprite
-    heal.m_vPos = GenRandomPosition(0.6f);
-
-    //randomize velocity direction and scale up
-    heal.m_vVel = (m_pRandom->randv());
-    heal.m_vVel.x *= 5.0f;
-    heal.m_vVel.y *= 30.0f;
-
-    //heal.m_vVel += this->m_vVelocity;   //add player velocity
-    heal.m_vVel.y = abs(heal.m_vVel.y); //make y velocity positive
-
-    randColor = m_pRandom->randn(0, 2); //random color
-    randSize = m_pRandom->randn(4, 15);//random size multiplier
-
-    //select random color
-    if (randColor == 0)
-      heal.m_f4Tint = XMFLOAT4(Colors::Green);
-    else if (randColor == 1)
-      heal.m_f4Tint = XMFLOAT4(Colors::GreenYellow);
-    else
-      heal.m_f4Tint = XMFLOAT4(Colors::ForestGreen);
-
-    heal.m_f4Tint.w = 0.8f; //const alpha for all particles
-
-    //apply random scale
-    heal.m_fMaxScale = 0.1f * (float)randSize;
-
-    //spawn particle
-    if (heal.m_nSpriteIndex) {
-      m_pParticleEngine->create(heal);
-    }
-  } //for
-
+  m_pEmitterManager->Emit(eEmitter::PlayerHeal, SEmitterSource(m_vPos, m_fRadius));
 } //HealFx
 
 /// Applies mana regen effect visuals to the player
 void CPlayer::ManaRegenFx() {
-  const int count = m_pRandom->randn(3, 8); //gen 3-8 particles each call
-  UINT randSize, randColor; //random vars
-  LParticleDesc2D mana;   //particle descriptor
-  for (int i = 0; i < count; i++) {
-    //select random sprite from ManaParticles
-    mana.m_nSpriteIndex = (UINT)eSprite::ManaParticles;
-    mana.m_nCurrentFrame = m_pRandom->randn(0, 7);
-
-    //fade properties
-    mana.m_fFadeOutFrac = 0.8f;
-    mana.m_fFadeInFrac = 0.2f;
-    mana.m_fLifeSpan = 1.2f;
-
-    //get random spawn position on top of the player
-    mana.m_vPos = this->GenRandomPosition(0.45f);
-
-    //offset y, account for scale
-    mana.m_vPos.y -= m_fRadius * 5.0f / 8.0f;
-
-    //randomize velocity direction and scale up
-    mana.m_vVel = (m_pRandom->randv());
-    mana.m_vVel.x *= 20.0f;
-    mana.m_vVel.y *= 100.0f;
-
-    //mana.m_vVel += this->m_vVelocity;   //add player velocity
-    mana.m_vVel.y = abs(mana.m_vVel.y); //make y velocity positive
-
-    randColor = m_pRandom->randn(0, 2); //random color
-    randSize = m_pRandom->randn(12, 22);//random size multiplier
-
-    //select random color
-    if (randColor == 0)
-      mana.m_f4Tint = XMFLOAT4(Colors::Violet);
-    else if (randColor == 1)
-      mana.m_f4Tint = XMFLOAT4(Colors::DeepPink);
-    else
-      mana.m_f4Tint = XMFLOAT4(Colors::DarkGoldenrod);
-
-    mana.m_f4Tint.w = 0.8f; //const alpha for all particles
-
-    //apply random scale
-    mana.m_fMaxScale = 0.1f * (float)randSize;
-
-    //spawn particle
-    if (mana.m_nSpriteIndex) {
-      m_pParticleEngine->create(mana);
-    }
-  } //for
-
+  m_pEmitterManager->Emit(eEmitter::PlayerMana, SEmitterSource(m_vPos, m_fRadius));
 } //ManaRegenFx
 
 /// Applies blood/damage effect visuals around the player
 void CPlayer::DamageFx() {
-  const int count = m_pRandom->randn(0, 12); //gen random amount of blood particles
-  UINT randColor, randSize; //random vars
-  LParticleDesc2D blood; //particle descriptor
-  for (int i = 0; i < count; i++) {
-    blood.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-
-    //fade properties
-    blood.m_fLifeSpan = 5.0f;
-    blood.m_fFadeOutFrac = 0.9f;
-    blood.m_fFadeInFrac = 0.1f;
-
-    //get random position within the player sprite
-    blood.m_vPos = GenRandomPosition(0.4f);
-
-    //offset y position to match sprite, account for scale
-    blood.m_vPos.y -= m_fRadius * 3.0f / 4.0f;
-
-    randColor = m_pRandom->randn(0, 2);    //random color 
-    randSize = m_pRandom->randn(0, 2);     //random size
-
-    //select random color
-    /*if (!randColor)
-      blood.m_f4Tint = XMFLOAT4(Colors::Gold);
-    else if (randColor == 1)
-      blood.m_f4Tint = XMFLOAT4(Colors::AntiqueWhite);
-    else
-      blood.m_f4Tint = XMFLOAT4(Colors::LightGoldenrodYellow);*/
-    blood.m_f4Tint = XMFLOAT4(0.651f, 0.063f, 0.118f, 0.0f); //blood red
-
-    blood.m_f4Tint.w = 0.6f; //const alpha for all particles
-
-    //select random size
-    if (!randSize)
-      blood.m_fMaxScale = 0.2f;
-    else if (randSize == 1)
-      blood.m_fMaxScale = 0.3f;
-    else
-      blood.m_fMaxScale = 0.4f;
-
-    //spawn particle
-    if (blood.m_nSpriteIndex) {
-      m_pParticleEngine->create(blood);
-    }
-  } //for
-
+  m_pEmitterManager->Emit(eEmitter::PlayerDamage, SEmitterSource(m_vPos, m_fRadius));
 } //DamageFx
 
 /// Creates dust that trails behind the player
 void CPlayer::RunFx() {
-  UINT randColor, randSize, randAlpha, randSprite, randLife; //random vars
-  LParticleDesc2D dust; //particle descriptor
-  Vector2 input_dir = Vector2(m_bStrafeRight - m_bStrafeLeft, m_bStrafeUp - m_bStrafeDown);
-  const float input_length = sqrt(input_dir.x * input_dir.x + input_dir.y * input_dir.y);
-  dust.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-
-  //fade properties
-  dust.m_fFadeOutFrac = 0.8f;
-  dust.m_fFadeInFrac = 0.01f;
-
-  //get random position within the player sprite
-  dust.m_vPos = GenRandomPosition(0.2f);
-
-  //offset y position to spawn at feet, account for scale
-  dust.m_vPos.y -= m_fRadius;
-
-  //offset the position of the dust to spawn just behind the players feet from getting kicked
-  dust.m_vPos += -Vector2(20.0f * cos(m_fFacingVector), 20.0f * sin(m_fFacingVector));
-
-  //printf("%f\n%f\n\n", input_dir.x, input_dir.y); //TODO update after player refactor
-  dust.m_vVel = input_dir * -1000.0f * m_pTimer->GetFrameTime();//TODO update after player refactor
-
-  randAlpha = m_pRandom->randn(1, 8);    //random alpha
-  randSize = m_pRandom->randn(1, 12);     //random size
-  randSprite = m_pRandom->randn(0, 5);     //random size
-  randLife = m_pRandom->randn(0, 100);
-  randColor = m_pRandom->randn(0, 2);
+  const Vector2 input_dir = Vector2(m_bStrafeRight - m_bStrafeLeft, m_bStrafeUp - m_bStrafeDown);
+  const Vector2 vel = input_dir * -1000.0f * m_pTimer->GetFrameTime(); //TODO update after player refactor
 
-
-  dust.m_f4Tint = XMFLOAT4(0.414f, 0.33f, 0.3012f, 0.0f);
-
-  dust.m_fAlpha = 0.01f; // Alpha of the actual dust, should be quite see-through
-  dust.m_fLifeSpan = 0.015f * (float)randLife;
-
-  //TODO scale according to direction travelling
-  dust.m_fMaxScale = 0.04f * (float)randSize; //apply random scale
-  if (randSprite == 0) {
-    dust.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-    dust.m_fMaxScale = 0.05f * (float)randSize; //apply random scale
-  }
-  else {
-    dust.m_nSpriteIndex = (UINT)eSprite::SmoothCircle;
-    dust.m_fMaxScale = 0.02f * (float)randSize; //apply random scale
-  }
   //TODO change dust color to match floor
   //TODO spawn secondary particles that travel slower after a short delay
-
-  //spawn particle
-  if (dust.m_nSpriteIndex) {
-    m_pParticleEngine->create(dust);
-  }
+  m_pEmitterManager->Emit(eEmitter::PlayerRun, SEmitterSource(m_vPos, m_fRadius, m_fFacingVector, vel));
 } //RunFx
 
 void CPlayer::CollectKey() { m_bHasKey = true; }
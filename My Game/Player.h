@@ -5,7 +5,7 @@
 #define __L4RC_GAME_PLAYER_H__
 
 #include "Object.h"
-#include "EventTimer.h"
+#include "PeriodicTimer.h"
 #include "Common.h"
 
 /// \brief The player object. 
@@ -39,12 +39,12 @@ protected:
   bool m_bIdle = false; ///< FOR IDLE ANIMATION
   bool m_bHasKey = false; ///< player picked up key
 
-  LEventTimer* m_pFrameEvent = nullptr; ///< Frame event timer.
-  LEventTimer* m_pDamageEvent = nullptr; ///< Player damage event timer
-  LEventTimer* m_pDeathEvent = nullptr; ///< Player death event timer
-  LEventTimer* m_pDashEvent = nullptr; ///< Player Dash event timer
-  LEventTimer* m_pRunEvent = nullptr; ///< Player Run event timer
-  LEventTimer* m_pIdleEvent = nullptr; ///< Player Idle event timer
+  CPeriodicTimer m_cFrameEvent; ///< Frame event timer.
+  CPeriodicTimer m_cDamageEvent; ///< Player damage event timer
+  CPeriodicTimer m_cDeathEvent; ///< Player death event timer
+  CPeriodicTimer m_cDashEvent; ///< Player Dash event timer
+  CPeriodicTimer m_cRunEvent; ///< Player Run event timer
+  CPeriodicTimer m_cIdleEvent; ///< Player Idle event timer
 
   ePlayerAnimationState state{ ePlayerAnimationState::NONE };
 
@@ -4,10 +4,11 @@
 #include "Rabite.h"
 #include "ComponentIncludes.h"
 #include "Particle.h"
-#include "ParticleEngine.h"
+#include "ParticleStore.h"
 #include "SimpleMath.h"
 #include "Helpers.h"
 #include "ObjectManager.h"
+#include "EmitterManager.h"
 #include "TileManager.h"
 #include "Player.h"
 
@@ -20,14 +21,15 @@ CRabite::CRabite(eSprite t, const Vector2& pos) : CObject(t, pos) {
   
   m_bIsTarget = true; //collides
   m_bStatic = false;  //not static
+  m_bIntegrate = false; //moves itself
 
   m_fRoll = 0.0f; //sprite rotation
   m_vVelocity = Vector2(0.0f, 0.0f); //still until first hop
   m_fXScale = m_fYScale = 2.0f; //scale
   m_fRadius = 1.8f;
 
-  m_pIdleEvent = new LEventTimer(0.3f); //period of frame events for slime
-  m_pWanderEvent = new LEventTimer(2.0f, 1.0f);
+  m_cIdleEvent.Start(0.3f); //period of frame events for slime
+  m_cWanderEvent.Start(2.0f, 1.0f);
 
   state = eRabiteState::IDLE; //initialize animation state to IDLE
 
@@ -35,30 +37,6 @@ CRabite::CRabite(eSprite t, const Vector2& pos) : CObject(t, pos) {
 
 /// Destructor.
 CRabite::~CRabite() {
-  if (m_pIdleEvent) {
-    delete m_pIdleEvent;
-    m_pIdleEvent = nullptr;
-  }
-  if (m_pHopEvent) {
-    delete m_pHopEvent;
-    m_pHopEvent = nullptr;
-  }
-  if (m_pDeathEvent) {
-    delete m_pDeathEvent;
-    m_pDeathEvent = nullptr;
-  }
-  if (m_pBiteEvent) {
-    delete m_pBiteEvent;
-    m_pBiteEvent = nullptr;
-  }
-  if (m_pDamageEvent) {
-    delete m_pDamageEvent;
-    m_pDamageEvent = nullptr;
-  }
-  if (m_pWanderEvent) {
-    delete m_pWanderEvent;
-    m_pWanderEvent = nullptr;
-  }
 } //destructor
 
 /// Cycle through the animation/action pipeline based on the circumstances of the OakSeed enemy
@@ -89,25 +67,16 @@ void CRabite::move() {
   }
 } //move
 
-/// Idle function for Rabite. Sets the idleevent timer, deletes othere timers (for proper animation timing)
+/// Idle function for Rabite. Sets the idleevent timer, stops other timers (for proper animation timing)
 /// then states animation state to idle. Animation direction is based on the direction the sprite is facing
 /// since it will try to face towards the player (a range is set for each)
 
 void CRabite::Idle() {
-  if (!m_pIdleEvent) {
-    if (m_pHopEvent) {
-      delete m_pHopEvent;
-      m_pHopEvent = nullptr;
-    }
-    if (m_pBiteEvent) {
-      delete m_pBiteEvent;
-      m_pBiteEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pIdleEvent = new LEventTimer(0.3f);
+  if (!m_cIdleEvent.IsRunning()) {
+    m_cHopEvent.Stop();
+    m_cBiteEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cIdleEvent.Start(0.3f);
   }
   state = eRabiteState::IDLE;
   //m_bBiting = false;
@@ -144,34 +113,25 @@ void CRabite::Idle() {
 void CRabite::Wander() {
   const float t = m_pTimer->GetTime(); //current time
 
-  if (m_pWanderEvent && m_pWanderEvent->Triggered()) { //enough time has passed
-    UINT multiplier = m_pRandom->randn(1, 16);
+  if (m_cWanderEvent.Triggered()) { //enough time has passed
+    UINT multiplier = m_cAIRandom.randn(1, 16);
     const float delta = (m_bStrayParity ? -1.3f : 1.3f) * 1.3f; //angle delta
 
     m_vVelocity = RotateVector(m_vVelocity, delta); //change direction by delta
     m_fFacingVector += delta; //rotate to face that direction
 
-    m_bStrayParity = m_pRandom->randf() < 0.5f; //next stray is randomly left or right
+    m_bStrayParity = m_cAIRandom.randf() < 0.5f; //next stray is randomly left or right
   }
 }
 
-/// Damage Trigger for Rabite to delete other event timers, sent a damage event timer and set animation state to hurt
+/// Damage Trigger for Rabite to stop other event timers, sent a damage event timer and set animation state to hurt
 
 void CRabite::DamageTrigger() {
-  if (!m_pDamageEvent) {
-    if (m_pHopEvent) {
-      delete m_pHopEvent;
-      m_pHopEvent = nullptr;
-    }
-    if (m_pBiteEvent) {
-      delete m_pBiteEvent;
-      m_pBiteEvent = nullptr;
-    }
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    m_pDamageEvent = new LEventTimer(0.2f);
+  if (!m_cDamageEvent.IsRunning()) {
+    m_cHopEvent.Stop();
+    m_cBiteEvent.Stop();
+    m_cIdleEvent.Stop();
+    m_cDamageEvent.Start(0.2f);
   }
   state = eRabiteState::HURT;
 }
@@ -223,27 +183,15 @@ void CRabite::Damage() {
   m_vPos += m_vVelocity * t;
 }
 
-/// Death function to delete other event timers and set a death event timer. Also sets animation state to death and sprite animation to death
+/// Death function to stop other event timers and set a death event timer. Also sets animation state to death and sprite animation to death
 
 void CRabite::Death() {
-  if (!m_pDeathEvent) {
-    if (m_pHopEvent) {
-      delete m_pHopEvent;
-      m_pHopEvent = nullptr;
-    }
-    if (m_pBiteEvent) {
-      delete m_pBiteEvent;
-      m_pBiteEvent = nullptr;
-    }
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pDeathEvent = new LEventTimer(0.12f);
+  if (!m_cDeathEvent.IsRunning()) {
+    m_cHopEvent.Stop();
+    m_cBiteEvent.Stop();
+    m_cIdleEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cDeathEvent.Start(0.12f);
   }
 
   if (state == eRabiteState::DEATH) {
@@ -262,49 +210,8 @@ void CRabite::Death() {
 /// colors them read and then gives them a random position. Eventually fade out
 
 void CRabite::DeathFx() {
-  const int count = m_pRandom->randn(0, 10); //gen random num blood parts
-  UINT randColor, randSize; //random vars
-  LParticleDesc2D blood;
-  for (int i = 0; i < count; i++) {
-    blood.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-
-    //fade properties
-    blood.m_fFadeOutFrac = 0.8f;
-    blood.m_fFadeInFrac = 0.2f;
-    blood.m_fLifeSpan = 4.0f;
-
-    //get random position within the slime sprite
-    blood.m_vPos = GenRandomPosition(10.0f);
-
-    //offset position to match sprite, account for scale
-    //blood.m_vPos.x -= m_fRadius * 0.75f;
-    //blood.m_vPos.y -= m_fRadius;
-
-    randColor = m_pRandom->randn(0, 2);    //random color 
-    randSize = m_pRandom->randn(0, 3);     //random size
-
-    //select random color
-    if (randColor == 0)
-      blood.m_f4Tint = XMFLOAT4(Colors::Black);
-    else if (randColor == 1)
-      blood.m_f4Tint = XMFLOAT4(Colors::DarkRed);
-    else
-      blood.m_f4Tint = XMFLOAT4(Colors::Red);
-
-    blood.m_f4Tint.w = 0.6f; //const alpha for all particles
-
-    //select random size
-    if (!randSize)
-      blood.m_fMaxScale = 0.2f;
-    else if (randSize == 1)
-      blood.m_fMaxScale = 0.25f;
-    else
-      blood.m_fMaxScale = 0.3f;
-
-    //spawn particle
-    m_pParticleEngine->create(blood);
-  }
-}
+  m_pEmitterManager->Emit(eEmitter::CritterDeath, SEmitterSource(m_vPos, m_fRadius));
+} //DeathFx
 
 /// Function that determines whether or not the player is detected, based on the position of the player
 /// the position of the enemy, and whether player is within an arbitrary circle around the enemy. The circle
@@ -312,8 +219,8 @@ void CRabite::DeathFx() {
 /// rotateTowards() function to rotate towards the player. Otherwise, wanders randomly
 
 void CRabite::FacePlayer() {
-  if (m_pPlayer) {
-    const float r = ((CRabite*)m_pPlayer)->m_fRadius; //player radius
+  if (m_hPlayer) {
+    const float r = ((CRabite*)m_hPlayer.Get())->m_fRadius; //player radius
     float dMin = 0.0f;
     if (m_bPlayerDetected) {
       dMin = 512.0f; //minimum distance at which target is invisible
@@ -324,14 +231,14 @@ void CRabite::FacePlayer() {
     
     const float dMinSq = dMin * dMin; //that squared
 
-    Vector2 pTarget = m_pPlayer->m_vPos;
+    Vector2 pTarget = m_hPlayer->m_vPos;
     Vector2 distance = pTarget - m_vPos;
     float mdistance = sqrt((distance.x * distance.x) + (distance.y * distance.y));
     float dsq = mdistance * mdistance; //distance squared to closest target
     //printf("min distance = %f  player distance = %f  ", dMinSq, dsq);
 
-    if (m_pTileManager->Visible(m_vPos, m_pPlayer->m_vPos, r) && dsq < dMinSq) { //player visible
-      RotateTowards(m_pPlayer->m_vPos, dsq); //rotate towards target
+    if (m_pTileManager->Visible(m_vPos, m_hPlayer->m_vPos, r) && dsq < dMinSq) { //player visible
+      RotateTowards(m_hPlayer->m_vPos, dsq); //rotate towards target
       m_bPlayerDetected = true;
     }
     else {
@@ -385,25 +292,16 @@ void CRabite::RotateTowards(const Vector2& pos, float dsq) {
   }
 } //RotateTowards
 
-/// function to head towards player. Deletes any eventtimers that aren't walk and sets it if not already set
+/// function to head towards player. Stops any event timers that aren't walk and sets it if not already set
 /// then gives animation based on facing vector and walks at a set speed. Also used for wandering, so
 /// enemy walks twice as fast when playe detected.
 
 void CRabite::MoveTowardsPlayer() {
-  if (!m_pHopEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pBiteEvent) {
-      delete m_pBiteEvent;
-      m_pBiteEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pHopEvent = new LEventTimer(0.2f);
+  if (!m_cHopEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
+    m_cBiteEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cHopEvent.Start(0.2f);
   }
 
   state = eRabiteState::HOP;
@@ -447,23 +345,14 @@ void CRabite::MoveTowardsPlayer() {
 
 } //MoveTowardsPlayer
 
-/// Function that sets a bite event (deletes all other timers), sets rabite animation state to Bite, and biting to true
+/// Function that sets a bite event (stops all other timers), sets rabite animation state to Bite, and biting to true
 
 void CRabite::BiteDashTrigger() {
-  if (!m_pBiteEvent) {
-    if (m_pIdleEvent) {
-      delete m_pIdleEvent;
-      m_pIdleEvent = nullptr;
-    }
-    if (m_pHopEvent) {
-      delete m_pHopEvent;
-      m_pHopEvent = nullptr;
-    }
-    if (m_pDamageEvent) {
-      delete m_pDamageEvent;
-      m_pDamageEvent = nullptr;
-    }
-    m_pBiteEvent = new LEventTimer(0.04f);
+  if (!m_cBiteEvent.IsRunning()) {
+    m_cIdleEvent.Stop();
+    m_cHopEvent.Stop();
+    m_cDamageEvent.Stop();
+    m_cBiteEvent.Start(0.04f);
   }
 
   state = eRabiteState::BITE;
@@ -531,7 +420,7 @@ void CRabite::BiteDashFX() {
   d.m_fAlpha = 0.1f;
   d.m_vPos = m_vPos; //center particle at player center
   if (d.m_nSpriteIndex) {
-    m_pParticleEngine->create(d);
+    m_pParticleStore->create(d, eParticleCategory::Trail);
   }
 }
 
@@ -541,39 +430,39 @@ void CRabite::BiteDashFX() {
 void CRabite::UpdateFramenumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
   if (state != eRabiteState::DEATH) {
-    if (n > 1 && m_pIdleEvent && m_pIdleEvent->Triggered()) {
+    if (n > 1 && m_cIdleEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bBiting = false;
       }
     }
-    else if (n > 1 && m_pDamageEvent && m_pDamageEvent->Triggered()) {
+    else if (n > 1 && m_cDamageEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bIsTarget = true;
         Idle();
       }
     }
-    else if (n > 1 && m_pBiteEvent && m_pBiteEvent->Triggered()) {
+    else if (n > 1 && m_cBiteEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
         m_bBiting = false;
         Idle();
       }
     }
-    else if (n > 1 && m_pHopEvent && m_pHopEvent->Triggered()) {
+    else if (n > 1 && m_cHopEvent.Triggered()) {
       m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
       if (m_nCurrentFrame == n - 1) {
       }
     }
   }
-  else if (n > 1 && m_pDeathEvent && m_pDeathEvent->Triggered() && state == eRabiteState::DEATH) {
+  else if (n > 1 && m_cDeathEvent.Triggered() && state == eRabiteState::DEATH) {
     DeathFx();
     m_bDeadCheck = true;
     m_bStatic = true;
     m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
     if (m_nCurrentFrame == n - 1) {
-      const UINT chance = m_pRandom->randn(1, 3);
+      const UINT chance = m_cAIRandom.randn(1, 3);
       if (chance == 1)
         m_pObjectManager->create(eSprite::HealthPotion, m_vPos);
       else if (chance == 2)
@@ -0,0 +1,217 @@
+/// \file RandomStream.cpp
+/// \brief Code for the random number stream CRandomStream.
+
+#include <cmath>
+#include <emmintrin.h>
+
+#include "RandomStream.h"
+
+/// Get the next value of a SplitMix64 sequence, which is used to spread a
+/// seed over the generator state.
+/// \param x [in, out] SplitMix64 state.
+/// \return Next value.
+
+static inline UINT64 SplitMix64(UINT64& x){
+  UINT64 z = (x += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+} //SplitMix64
+
+/// Rotate left.
+/// \param x Value to rotate.
+/// \param k Number of bits.
+/// \return x rotated left by k bits.
+
+static inline UINT Rotl(UINT x, int k){
+  return (x << k) | (x >> (32 - k));
+} //Rotl
+
+/// Rotate each lane left.
+/// \param x Values to rotate.
+/// \param k Number of bits.
+/// \return x with each lane rotated left by k bits.
+
+#define ROTL4(x, k) _mm_or_si128(_mm_slli_epi32((x), (k)), _mm_srli_epi32((x), 32 - (k)))
+
+/// Advance four xoshiro128** generators running side by side.
+/// \param s Generator state, one register per word and one lane per generator.
+/// \return 32 random bits from each generator.
+
+static inline __m128i Next4(__m128i s[4]){
+  __m128i r = _mm_add_epi32(s[1], _mm_slli_epi32(s[1], 2)); //times 5
+  r = ROTL4(r, 7);
+  r = _mm_add_epi32(r, _mm_slli_epi32(r, 3)); //times 9
+
+  const __m128i t = _mm_slli_epi32(s[1], 9);
+  s[2] = _mm_xor_si128(s[2], s[0]);
+  s[3] = _mm_xor_si128(s[3], s[1]);
+  s[1] = _mm_xor_si128(s[1], s[2]);
+  s[0] = _mm_xor_si128(s[0], s[3]);
+  s[2] = _mm_xor_si128(s[2], t);
+  s[3] = ROTL4(s[3], 11);
+
+  return r;
+} //Next4
+
+/// Map 32 random bits into [0, n) by taking the high half of a 64-bit
+/// product, which is much faster than a modulus.
+/// \param x Random bits.
+/// \param n Size of range, or zero for all 2^32 values.
+/// \return Value in range.
+
+static inline UINT Scale(UINT x, UINT n){
+  return n == 0? x: (UINT)(((UINT64)x*n) >> 32);
+} //Scale
+
+/// Construct and seed a stream.
+/// \param seed Seed.
+/// \param stream Stream number, so that one seed can give several streams.
+
+CRandomStream::CRandomStream(UINT64 seed, UINT64 stream){
+  Seed(seed, stream);
+} //constructor
+
+/// Seed the stream. The same seed and stream number always give the same
+/// sequence of values.
+/// \param seed Seed.
+/// \param stream Stream number, so that one seed can give several streams.
+
+void CRandomStream::Seed(UINT64 seed, UINT64 stream){
+  UINT64 x = seed ^ (stream*0xD1B54A32D192ED03ULL); //SplitMix64 state
+
+  for(UINT i=0; i<4; i+=2){
+    const UINT64 z = SplitMix64(x);
+    m_nState[i] = (UINT)z;
+    m_nState[i + 1] = (UINT)(z >> 32);
+  } //for
+
+  for(UINT k=0; k<4; k++)
+    for(UINT j=0; j<4; j+=2){
+      const UINT64 z = SplitMix64(x);
+      m_nLanes[k][j] = (UINT)z;
+      m_nLanes[k][j + 1] = (UINT)(z >> 32);
+    } //for
+} //Seed
+
+/// Get the next value from the single value generator.
+/// \return 32 random bits.
+
+const UINT CRandomStream::Next(){
+  UINT* s = m_nState; //shorthand
+  const UINT result = Rotl(s[1]*5, 7)*9;
+  const UINT t = s[1] << 9;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = Rotl(s[3], 11);
+
+  return result;
+} //Next
+
+/// Get a random integer in a range.
+/// \param i Smallest value.
+/// \param j Largest value.
+/// \return Random integer in [i, j].
+
+const UINT CRandomStream::randn(UINT i, UINT j){
+  return i + Scale(Next(), j - i + 1);
+} //randn
+
+/// Get a random float from the top 24 bits of the next value.
+/// \return Random float in [0, 1).
+
+const float CRandomStream::randf(){
+  return (Next() >> 8)*(1.0f/16777216.0f);
+} //randf
+
+/// Get a random unit vector.
+/// \return Unit vector in a random direction.
+
+const Vector2 CRandomStream::randv(){
+  const float theta = XM_2PI*randf(); //random angle
+  return Vector2(cosf(theta), sinf(theta));
+} //randv
+
+/// Fill an array with random integers in a range, four at a time.
+/// \param p Pointer to the array.
+/// \param n Number of integers.
+/// \param i Smallest value.
+/// \param j Largest value.
+
+void CRandomStream::FillInts(UINT* p, size_t n, UINT i, UINT j){
+  const UINT range = j - i + 1; //size of range, zero for all values
+
+  __m128i s[4]; //generator state
+
+  for(UINT m=0; m<4; m++)
+    s[m] = _mm_loadu_si128((const __m128i*)m_nLanes[m]);
+
+  const __m128i vrange = _mm_set1_epi32((int)range);
+  const __m128i vmin = _mm_set1_epi32((int)i);
+  const __m128i hi = _mm_set_epi32(-1, 0, -1, 0); //high half of each 64-bit lane
+
+  size_t k = 0; //index into array
+
+  while(k < n){
+    __m128i r = Next4(s); //random bits
+
+    if(range != 0){ //high halves of the 64-bit products, lanes 0 and 2 then 1 and 3
+      const __m128i even = _mm_srli_epi64(_mm_mul_epu32(r, vrange), 32);
+      const __m128i odd = _mm_and_si128(_mm_mul_epu32(_mm_srli_epi64(r, 32), vrange), hi);
+      r = _mm_add_epi32(vmin, _mm_or_si128(even, odd));
+    } //if
+
+    if(k + 4 <= n){
+      _mm_storeu_si128((__m128i*)(p + k), r);
+      k += 4;
+    } //if
+
+    else{ //last few
+      UINT v[4];
+      _mm_storeu_si128((__m128i*)v, r);
+      for(UINT m=0; k<n; m++)
+        p[k++] = v[m];
+    } //else
+  } //while
+
+  for(UINT m=0; m<4; m++)
+    _mm_storeu_si128((__m128i*)m_nLanes[m], s[m]);
+} //FillInts
+
+/// Fill an array with random floats in [0, 1), four at a time, from the top
+/// 24 bits of each value.
+/// \param p Pointer to the array.
+/// \param n Number of floats.
+
+void CRandomStream::FillFloats(float* p, size_t n){
+  __m128i s[4]; //generator state
+
+  for(UINT m=0; m<4; m++)
+    s[m] = _mm_loadu_si128((const __m128i*)m_nLanes[m]);
+
+  const __m128 scale = _mm_set1_ps(1.0f/16777216.0f);
+  size_t k = 0; //index into array
+
+  while(k < n){
+    const __m128 r = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Next4(s), 8)), scale);
+
+    if(k + 4 <= n){
+      _mm_storeu_ps(p + k, r);
+      k += 4;
+    } //if
+
+    else{ //last few
+      float v[4];
+      _mm_storeu_ps(v, r);
+      for(UINT m=0; k<n; m++)
+        p[k++] = v[m];
+    } //else
+  } //while
+
+  for(UINT m=0; m<4; m++)
+    _mm_storeu_si128((__m128i*)m_nLanes[m], s[m]);
+} //FillFloats
@@ -0,0 +1,39 @@
+/// \file RandomStream.h
+/// \brief Interface for the random number stream CRandomStream.
+
+#ifndef __L4RC_GAME_RANDOMSTREAM_H__
+#define __L4RC_GAME_RANDOMSTREAM_H__
+
+#include "Defines.h"
+
+/// \brief A seedable stream of pseudo-random numbers.
+///
+/// A small, fast xoshiro128** generator that a subsystem can own, so that
+/// its random numbers don't depend on what the rest of the game draws and
+/// can be reproduced by seeding it. Single values come from one generator.
+/// Arrays are filled by four more generators that run side by side in the
+/// lanes of SSE2 registers. Integers in a range are made from the high bits
+/// with a multiply and a shift instead of a modulus. The reader functions
+/// have the same names as those of `LRandom`, so a stream can stand in for
+/// `m_pRandom`.
+
+class CRandomStream{
+  private:
+    UINT m_nState[4]; ///< State of the single value generator.
+    UINT m_nLanes[4][4]; ///< State of the array generators, one column per lane.
+
+  public:
+    CRandomStream(UINT64=0, UINT64=0); ///< Constructor.
+
+    void Seed(UINT64, UINT64=0); ///< Seed the stream.
+
+    const UINT Next(); ///< Get 32 random bits.
+    const UINT randn(UINT, UINT); ///< Get a random integer in a range.
+    const float randf(); ///< Get a random float in [0, 1).
+    const Vector2 randv(); ///< Get a random unit vector.
+
+    void FillInts(UINT*, size_t, UINT, UINT); ///< Fill an array with random integers in a range.
+    void FillFloats(float*, size_t); ///< Fill an array with random floats in [0, 1).
+}; //CRandomStream
+
+#endif //__L4RC_GAME_RANDOMSTREAM_H__
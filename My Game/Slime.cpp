@@ -3,11 +3,10 @@
 
 #include "Slime.h"
 #include "ComponentIncludes.h"
-#include "Particle.h"
-#include "ParticleEngine.h"
 #include "SimpleMath.h"
 #include "Helpers.h"
 #include "ObjectManager.h"
+#include "EmitterManager.h"
 
 /// Create and initialize an Slime object given its initial position.
 /// \param pos Initial position of slime.
@@ -26,8 +25,8 @@ CSlime::CSlime(const Vector2& pos, const UINT maxHp) :
     m_fXScale = m_fYScale = 2.0f; //scale
     //m_fRadius *= m_fXScale; //scale the bounding circle radius
 
-    m_pFrameEvent = new LEventTimer(0.2f); //period of frame events for slime
-    m_pHopEvent = new LEventTimer(1.6f); //period of hop event. on trigger, slime hops
+    m_cFrameEvent.Start(0.2f); //period of frame events for slime
+    m_cHopEvent.Start(1.6f); //period of hop event. on trigger, slime hops
 
     m_bIsTarget = true; //collides
     m_bStatic = false;  //not static
@@ -35,8 +34,6 @@ CSlime::CSlime(const Vector2& pos, const UINT maxHp) :
 
 /// Destructor.
 CSlime::~CSlime() {
-    delete m_pFrameEvent;
-    delete m_pHopEvent;
 } //destructor
 
 
@@ -44,10 +41,9 @@ CSlime::~CSlime() {
 void CSlime::move() {
     if (!m_bDead && !m_bStatic) {
         //call hop fn if hopevent triggered and state is IDLE
-        if (state == eSlimeState::IDLE && m_pHopEvent && m_pHopEvent->Triggered())
+        if (state == eSlimeState::IDLE && m_cHopEvent.Triggered())
             hop();
-        UpdateFramenumber();
-        m_vPos += m_vVelocity * m_pTimer->GetFrameTime(); //update position
+        UpdateFramenumber(); //position is integrated by the object manager
     } //if
 
 } //move
@@ -102,49 +98,7 @@ void CSlime::death() {
 /// Create slime blood particles as slime disintegrates. lots of randomness. 
 /// </summary>
 void CSlime::deathFx() {
-    const int count = m_pRandom->randn(8, 16); //gen random num blood parts
-    UINT randColor, randSize; //random vars
-    LParticleDesc2D blood;
-    for (int i = 0; i < count; i++) {
-        blood.m_nSpriteIndex = (UINT)eSprite::CircleNoBorder;
-
-        //fade properties
-        blood.m_fFadeOutFrac = 0.8f;
-        blood.m_fFadeInFrac = 0.2f;
-        blood.m_fLifeSpan = 4.0f;
-
-        //get random position within the slime sprite
-        blood.m_vPos = GenRandomPosition(0.3f);
-
-        //offset position to match sprite, account for scale
-        blood.m_vPos.x -= m_fRadius * 0.25f;
-        blood.m_vPos.y -= m_fRadius;
-
-        randColor = m_pRandom->randn(0, 2);    //random color 
-        randSize = m_pRandom->randn(0, 2);     //random size
-
-        //select random color
-        if (randColor == 0) 
-            blood.m_f4Tint = XMFLOAT4(Colors::Black);
-        else if(randColor == 1)
-            blood.m_f4Tint = XMFLOAT4(Colors::DarkRed);
-        else 
-            blood.m_f4Tint = XMFLOAT4(Colors::Red);
-
-        blood.m_f4Tint.w = 0.6f; //const alpha for all particles
-        
-        //select random size
-        if (!randSize)
-            blood.m_fMaxScale = 0.2f;
-        else if (randSize == 1)
-            blood.m_fMaxScale = 0.25f;
-        else
-            blood.m_fMaxScale = 0.3f;
-
-        //spawn particle
-        m_pParticleEngine->create(blood);
-    } //for
-
+    m_pEmitterManager->Emit(eEmitter::SlimeDeath, SEmitterSource(m_vPos, m_fRadius));
 } //deathFx
 
 /////// Adjust direction randomly at random intervals.
@@ -152,27 +106,27 @@ void CSlime::StrayFromPath() {
     //TODO make slime move towards player
     const float t = m_pTimer->GetTime(); //current time
 
-    UINT multiplier = m_pRandom->randn(1, 16);
+    UINT multiplier = m_cAIRandom.randn(1, 16);
     const float delta = multiplier * (m_bStrayParity ? -1.0f : 1.0f) * 0.4f; //angle delta
 
     m_vVelocity = RotateVector(m_vVelocity, delta); //change direction by delta
     //m_fRoll = XM_2PI;
     //m_fRoll += delta; //rotate to face that direction
 
-    m_bStrayParity = m_pRandom->randf() < 0.5f; //next stray is randomly left or right 
+    m_bStrayParity = m_cAIRandom.randf() < 0.5f; //next stray is randomly left or right 
 } //StrayFromPath
 
 ///Set random time to hop. This time is a multiple of the idle animation to make it more predictable 
 ///an offset is taken as arg. If no offset, pass in 0.0f
 void CSlime::SetRandHopDelay(float offset) {
-    UINT wait = m_pRandom->randn(1, 4);
-    m_pHopEvent->SetDelay((float)(wait * 0.8f) + offset);
+    UINT wait = m_cAIRandom.randn(1, 4);
+    m_cHopEvent.SetDelay((float)(wait * 0.8f) + offset);
 } //SetRandHopDelay
 
 /// Update the frame number in the animation sequence.
 void CSlime::UpdateFramenumber() {
     const size_t n = m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
-    if (n > 1 && m_pFrameEvent && m_pFrameEvent->Triggered()){
+    if (n > 1 && m_cFrameEvent.Triggered()){
         if (m_nCurrentFrame + 1 >= n)
         {
             HandleFrameLoop(n); //call fn when animation reaches last frame
@@ -212,7 +166,7 @@ void CSlime::HandleFrameLoop(size_t n) {
         m_bStatic = true;
         m_bDead = true;         //flag for destruction
         m_nCurrentFrame = (UINT)(n - 1);    //last frame of death anim
-        const UINT chance = m_pRandom->randn(1, 3);
+        const UINT chance = m_cAIRandom.randn(1, 3);
         if (chance == 1)
             m_pObjectManager->create(eSprite::HealthPotion, m_vPos);
         else if(chance == 2)
@@ -18,8 +18,8 @@ protected:
     UINT m_nMaxHealth; ///< Maximum health.
     UINT m_nHealth; ///< Current health.
     UINT m_nJiggle;
-    LEventTimer* m_pFrameEvent = nullptr; ///< Frame event timer.
-    LEventTimer* m_pHopEvent = nullptr; ///< Hop event timer.
+    CPeriodicTimer m_cFrameEvent; ///< Frame event timer.
+    CPeriodicTimer m_cHopEvent; ///< Hop event timer.
 
     bool m_bStrayParity = true; ///< Stray from path left or right.
     bool m_bPreferPosRot = false; ///< Prefer positive rotation.
@@ -4,7 +4,7 @@
 #include "SlimeBig.h"
 #include "ComponentIncludes.h"
 #include "Particle.h"
-#include "ParticleEngine.h"
+#include "ParticleStore.h"
 #include "SimpleMath.h"
 #include "ObjectManager.h"
 #include "Helpers.h"
@@ -26,8 +26,8 @@ CSlimeBig::CSlimeBig(const Vector2& pos, const UINT maxHp) :
     m_fXScale = m_fYScale = 3.0f; //scale
     //m_fRadius *= m_fXScale; //scale the bounding circle radius
 
-    m_pFrameEvent = new LEventTimer(0.2f); //period of frame events for big slime
-    m_pHopEvent = new LEventTimer(1.2f);   //period of hop event. on trigger, big slime hops
+    m_cFrameEvent.Start(0.2f); //period of frame events for big slime
+    m_cHopEvent.Start(1.2f);   //period of hop event. on trigger, big slime hops
 
     m_bIsTarget = true; //collides
     m_bStatic = false;  //not static
@@ -35,19 +35,15 @@ CSlimeBig::CSlimeBig(const Vector2& pos, const UINT maxHp) :
 
 /// Destructor.
 CSlimeBig::~CSlimeBig() {
-    delete m_pFrameEvent;
-    delete m_pHopEvent;
 } //destructor
 
 /// Change state to hop periodically. Advance frame num for current animation
 void CSlimeBig::move() {
     if (!m_bDead && !m_bStatic) {
         //call hop fn if hopevent triggered and state is IDLE
-        if (state == eSlimeState::IDLE && m_pHopEvent && m_pHopEvent->Triggered())
+        if (state == eSlimeState::IDLE && m_cHopEvent.Triggered())
             hop();
-        UpdateFramenumber();
-
-        m_vPos += m_vVelocity * m_pTimer->GetFrameTime(); //update position
+        UpdateFramenumber(); //position is integrated by the object manager
     } //if
 
 } //move
@@ -102,25 +98,25 @@ void CSlimeBig::StrayFromPath() {
     //TODO make slime move towards player when within a certain distance
     const float t = m_pTimer->GetTime(); //current time
 
-    UINT multiplier = m_pRandom->randn(1, 16);
+    UINT multiplier = m_cAIRandom.randn(1, 16);
     const float delta = multiplier * (m_bStrayParity ? -1.0f : 1.0f) * 0.4f; //angle delta
 
     m_vVelocity = RotateVector(m_vVelocity, delta); //change direction by delta
 
-    m_bStrayParity = m_pRandom->randf() < 0.5f; //next stray is randomly left or right 
+    m_bStrayParity = m_cAIRandom.randf() < 0.5f; //next stray is randomly left or right 
 } //StrayFromPath
 
 /// Set random time to hop. This time is a multiple of the idle animation - as a gameplay mechanic -
 /// to make it more predictable. A time offset is taken as parameter. If no offset, pass in 0.0f
 void CSlimeBig::SetRandHopDelay(float offset) {
-    UINT wait = m_pRandom->randn(1, 5);
-    m_pHopEvent->SetDelay((float)(wait * 0.8f) + offset);
+    UINT wait = m_cAIRandom.randn(1, 5);
+    m_cHopEvent.SetDelay((float)(wait * 0.8f) + offset);
 } //SetRandHopDelay
 
 /// Update the frame number in the animation sequence.
 void CSlimeBig::UpdateFramenumber() {
     const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
-    if (n > 1 && m_pFrameEvent && m_pFrameEvent->Triggered()) { //if frame event and sprite is anim
+    if (n > 1 && m_cFrameEvent.Triggered()) { //if frame event and sprite is anim
         if ((m_nCurrentFrame + 1) >= n)
         {
             HandleFrameLoop(n); //call fn when animation reaches last frame
@@ -151,15 +147,15 @@ void CSlimeBig::UpdateFramenumber() {
 
 /// spawn moving slime fragments on split. lots of randomness.
 /// ending position of moving particles is calculated with the lifetime and vel.
-/// adds particles to m_pTimedEvents for delayed spawn. 
+/// adds particles to m_cTimedEvents for delayed spawn. 
 void CSlimeBig::splitFx() {
-    const int count = m_pRandom->randn(6, 12); //gen random num slime fragments
+    const int count = m_cEffectsRandom.randn(6, 12); //gen random num slime fragments
     UINT randSpeed, randSize; //random vars
     float endingX, endingY;
     LParticleDesc2D movingPart, endPart; //moving and delayed particles
     for (int i = 0; i < count; i++) {
         movingPart.m_nSpriteIndex = (UINT)eSprite::SlimeParticles;
-        movingPart.m_nCurrentFrame = m_pRandom->randn(0, 8); //random sprite index
+        movingPart.m_nCurrentFrame = m_cEffectsRandom.randn(0, 8); //random sprite index
 
         //set tint to big slime tint
         movingPart.m_f4Tint = m_f4Tint;
@@ -169,14 +165,14 @@ void CSlimeBig::splitFx() {
         movingPart.m_fFadeInFrac = 0.4f;
 
         //random start position on slime sprite
-        movingPart.m_vPos = GenRandomPosition(0.05f); //TODO update multiplier after hurtbox is scaled down
+        movingPart.m_vPos = GenRandomPosition(0.05f, m_cEffectsRandom); //TODO update multiplier after hurtbox is scaled down
         movingPart.m_vPos.y -= m_fRadius * 0.75f; //offset
 
         //set velocity to random direction
-        movingPart.m_vVel = m_pRandom->randv();
+        movingPart.m_vVel = m_cEffectsRandom.randv();
 
-        randSpeed = m_pRandom->randn(60, 300);  //random speed
-        randSize = m_pRandom->randn(6, 14);     //random size
+        randSpeed = m_cEffectsRandom.randn(60, 300);  //random speed
+        randSize = m_cEffectsRandom.randn(6, 14);     //random size
 
         //apply random speed
         movingPart.m_vVel.x *= randSpeed;
@@ -204,11 +200,11 @@ void CSlimeBig::splitFx() {
         endPart.m_fFadeOutFrac = 0.95f;
         endPart.m_fFadeInFrac = 0.00f;
 
-        //store ending particle in Common vector to be created later
-        m_pTimedEvents.emplace(CTimedSpawn::CTimedSpawn(m_pTimer->GetTime() + movingPart.m_fLifeSpan - 0.05f, endPart));
+        //schedule ending particle in Common timing wheel to be created later
+        m_cTimedEvents.Schedule(movingPart.m_fLifeSpan - 0.05f, endPart, eParticleCategory::Combat);
 
         //spawn moving particle
-        m_pParticleEngine->create(movingPart);
+        m_pParticleStore->create(movingPart, eParticleCategory::Combat);
     } //for
 
 } // splitFx
@@ -297,7 +293,7 @@ void CSlimeBig::DeathFX() {
     //d.m_fScaleInFrac = 0.5f;
     //d.m_fFadeOutFrac = 0.8f;
     //d.m_fScaleOutFrac = 0;
-    //m_pParticleEngine->create(d);
+    //m_pParticleStore->create(d);
 
     //d.m_nSpriteIndex = (UINT)eSprite::Spark;
     //d.m_fLifeSpan = 0.5f;
@@ -306,5 +302,5 @@ void CSlimeBig::DeathFX() {
     //d.m_fScaleOutFrac = 0.3f;
     //d.m_fFadeOutFrac = 0.5f;
     //d.m_f4Tint = XMFLOAT4(Colors::Orange);
-    //m_pParticleEngine->create(d);
+    //m_pParticleStore->create(d);
 } //DeathFX
@@ -4,7 +4,7 @@
 #include "SwordAttack.h"
 #include "ComponentIncludes.h"
 #include "Particle.h"
-#include "ParticleEngine.h"
+#include "ParticleStore.h"
 #include "Helpers.h"
 
 /// Create and initialize a sword attack object given its intial position
@@ -77,5 +77,5 @@ void CSwordAttack::DeathFX() {
   d.m_fFadeOutFrac = 0.8f;
   d.m_fScaleOutFrac = d.m_fFadeOutFrac;
 
-  m_pParticleEngine->create(d); //create particle
+  m_pParticleStore->create(d, eParticleCategory::Combat); //create particle
 } //DeathFX
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include "SpriteRenderer.h"
 #include "Abort.h"
 
+#include <chrono>
+
 /*Codes for map and mask txts
 * Masks are NOT zero indexed - indexing starts at 1
 MAP
@@ -66,14 +68,9 @@ CTileManager::CTileManager(size_t n):
   m_fTileSize((float)n){
 } //constructor
 
-/// Delete the memory used for storing the map.
+/// Destructor. The map is freed along with its vector.
 
 CTileManager::~CTileManager(){
-    for (size_t i = 0; i < m_nHeight; i++) {
-        delete[] m_chMap[i];
-        //TODO del mask
-    } //for
-  delete[] m_chMap;
 } //destructor
 
 /// Make the AABBs for the walls. Care is taken to use the longest horizontal
@@ -97,7 +94,7 @@ void CTileManager::MakeBoundingBoxes() {
         size_t j = 0; //column index
         pos.x = vstart.x; //set start position x coordinate
         while (j < m_nWidth) { //for each column
-            while (j < m_nWidth && m_chMap[i][j] != 'W' && m_chMap[i][j] != 'X') { //skip over non-wall entries
+            while (j < m_nWidth && !(At(i, j).m_nFlags & STile::SOLID)) { //skip over non-wall entries
                 j++; //next column
                 pos.x += t; //move right by tile width
             } //while
@@ -111,7 +108,7 @@ void CTileManager::MakeBoundingBoxes() {
 
             bool bSingleTile = true; //as far as we know, this is a single-tile wall
 
-            while (j < m_nWidth && (m_chMap[i][j] == 'W' || m_chMap[i][j] == 'X')) { //for each adjacent wall tile
+            while (j < m_nWidth && (At(i, j).m_nFlags & STile::SOLID)) { //for each adjacent wall tile
                 b.Center = Vector3(pos.x, pos.y, 0); //bounding box center
                 BoundingBox::CreateMerged(aabb, aabb, b); //merge b into aabb
                 bSingleTile = false; //the wall now has at least 2 tiles in it
@@ -135,7 +132,7 @@ void CTileManager::MakeBoundingBoxes() {
         pos.y = vstart.y; //set start position y coordinate
 
         while (i < m_nHeight) { //for each row
-            while (i < m_nHeight && m_chMap[i][j] != 'W') { //skip over non-wall entries
+            while (i < m_nHeight && !(At(i, j).m_nFlags & STile::WALL)) { //skip over non-wall entries
                 i++; //next row
                 pos.y -= t; //move down by tile height
             } //while
@@ -149,7 +146,7 @@ void CTileManager::MakeBoundingBoxes() {
 
             bool bSingleTile = true; //as far as we know, this is a single-tile wall
 
-            while (i < m_nHeight && m_chMap[i][j] == 'W') { //for each adjacent wall tile
+            while (i < m_nHeight && (At(i, j).m_nFlags & STile::WALL)) { //for each adjacent wall tile
                 b.Center = Vector3(pos.x, pos.y, 0); //bounding box center
                 BoundingBox::CreateMerged(aabb, aabb, b); //merge b into aabb
                 bSingleTile = false; //the wall now has at least 2 tiles in it
@@ -169,16 +166,16 @@ void CTileManager::MakeBoundingBoxes() {
   pos = vstart; //reset current position to start position
   for(size_t i=0; i<m_nHeight; i++){ //for each row
     for(size_t j=0; j<m_nWidth; j++){ //for each column
-        //if (m_chMap[i][j] == 'W') {
+        //if (At(i, j).m_chGround == 'W') {
         //    b.Center = Vector3(pos.x, pos.y, 0); //bounding box center
         //    m_vecWalls.push_back(b); //add single-tile wall to the list
         //}
 
-      if((m_chMap[i][j] == 'W') && //is a wall tile and
-        ((i == 0 || (m_chMap[i - 1][j] != 'W') && //has non-wall tile below or is on edge
-         (i == m_nHeight - 1 || (m_chMap[i + 1][j] != 'W' )) && //has non-wall tile above or is on edge
-         (j == 0 || (m_chMap[i][j - 1] != 'W')) && //has non-wall tile at left or is on edge
-         (j == m_nWidth - 1 || (m_chMap[i][j + 1] != 'W')) //has non-wall tile at right or is on edge
+      if((At(i, j).m_chGround == 'W') && //is a wall tile and
+        ((i == 0 || (At(i - 1, j).m_chGround != 'W') && //has non-wall tile below or is on edge
+         (i == m_nHeight - 1 || (At(i + 1, j).m_chGround != 'W' )) && //has non-wall tile above or is on edge
+         (j == 0 || (At(i, j - 1).m_chGround != 'W')) && //has non-wall tile at left or is on edge
+         (j == m_nWidth - 1 || (At(i, j + 1).m_chGround != 'W')) //has non-wall tile at right or is on edge
         ))){    
         b.Center = Vector3(pos.x, pos.y, 0); //bounding box center
         m_vecWalls.push_back(b); //add single-tile wall to the list
@@ -190,8 +187,38 @@ void CTileManager::MakeBoundingBoxes() {
     pos.x = vstart.x; //first column
     pos.y -= t; //next row
   } //for
+
+  MakeWallIndex();
 } //MakeBoundingBoxes
 
+/// Make an index from each tile to the walls that overlap it so that
+/// collision tests only need to look at the walls near an object. Tiles are
+/// indexed by world position, that is, the bottom row of the map comes first.
+
+void CTileManager::MakeWallIndex(){
+  m_vecWallIndex.clear();
+  m_vecWallIndex.resize(m_nWidth*m_nHeight);
+  m_vecWallStamp.assign(m_vecWalls.size(), 0);
+  m_nWallQuery = 0;
+
+  const float t = m_fTileSize; //shorthand for tile width and height
+
+  for(UINT n=0; n<(UINT)m_vecWalls.size(); n++){ //for each wall
+    const BoundingBox& aabb = m_vecWalls[n]; //shorthand
+
+    //walls are made of whole tiles, so round to the nearest tile boundary
+
+    const int left   = std::max(0, (int)floorf((aabb.Center.x - aabb.Extents.x)/t + 0.5f));
+    const int right  = std::min((int)m_nWidth - 1, (int)floorf((aabb.Center.x + aabb.Extents.x)/t - 0.5f));
+    const int bottom = std::max(0, (int)floorf((aabb.Center.y - aabb.Extents.y)/t + 0.5f));
+    const int top    = std::min((int)m_nHeight - 1, (int)floorf((aabb.Center.y + aabb.Extents.y)/t - 0.5f));
+
+    for(int i=bottom; i<=top; i++) //for each row the wall covers
+      for(int j=left; j<=right; j++) //for each column the wall covers
+        m_vecWallIndex[i*m_nWidth + j].push_back(n);
+  } //for
+} //MakeWallIndex
+
 
 /// <summary>
 /// Delete the old map (if any), allocate the right sized chunk of memory for
@@ -207,34 +234,9 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
   m_vEntryPortalPosition = Vector2::Zero;
   m_vExitPortalPosition = Vector2::Zero;
   
-  InitializeGroundMap();    //creates ground map to be referenced during draw fn
-  InitializeFlavorValMap(); //creates flavor map to be referenced during draw fn
-
-  //unload any previous maps, flavors, and masks
-  if(m_chMap != nullptr){ 
-      for (size_t i = 0; i < m_nHeight; i++)
-          delete[] m_chMap[i];
-      delete [] m_chMap;
-  } //if
-  if (m_chMapMask != nullptr) {
-      for (size_t i = 0; i < m_nHeight; i++)
-          delete[] m_chMapMask[i];
-
-      delete[] m_chMapMask;
-  } //if
-  if (m_chFlavor != nullptr) {
-      for (size_t i = 0; i < m_nHeight; i++)
-          delete[] m_chFlavor[i];
-
-      delete[] m_chFlavor;
-  } //if
-  if (m_chFlavorMask != nullptr) {
-      for (size_t i = 0; i < m_nHeight; i++)
-          delete[] m_chFlavorMask[i];
+  InitializeGroundMap();    //creates ground table to be referenced during draw fn
+  InitializeFlavorValMap(); //creates flavor table to be referenced during draw fn
 
-      delete[] m_chFlavorMask;
-  } //if
- 
   m_vecTurrets.clear(); //clear out the turret list
   m_vecSlimes.clear();
   m_vecBigSlimes.clear();
@@ -333,18 +335,9 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
 
   m_nWidth--;
 
-  //allocate space for the map and associated collections
-  m_chMap = new char*[m_nHeight];
-  m_chMapMask = new char* [m_nHeight];
-  m_chFlavor = new char*[m_nHeight];
-  m_chFlavorMask = new char* [m_nHeight];
-
-  for (size_t i = 0; i < m_nHeight; i++) {
-      m_chMap[i] = new char[m_nWidth];
-      m_chMapMask[i] = new char[m_nWidth];
-      m_chFlavor[i] = new char[m_nWidth];
-      m_chFlavorMask[i] = new char [m_nWidth];
-  } //for
+  //allocate space for the map, replacing any previous one
+
+  m_vecTiles.assign(m_nWidth*m_nHeight, STile());
 
   //load the map information from the buffer to the map
 
@@ -360,49 +353,49 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
       int val = 0;
 
       //just store the chars for these txts. no substitution needed
-      m_chFlavor[i][j] = f;  
-      m_chMapMask[i][j] = n;
-      m_chFlavorMask[i][j] = m;
+      At(i, j).m_chFlavor = f;  
+      At(i, j).m_chGroundMask = n;
+      At(i, j).m_chFlavorMask = m;
 
       Vector2 pos;
       switch (c) {
       case 'T':
-          m_chMap[i][j] = 'F'; //floor tile
+          At(i, j).m_chGround = 'F'; //floor tile
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecTurrets.push_back(pos);
           break;
       case 's':
-          m_chMap[i][j] = 'F'; // spikes
+          At(i, j).m_chGround = 'F'; // spikes
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecSpikes.push_back(pos);
           break;
       case 'L':
-          m_chMap[i][j] = 'F'; //floor tile
+          At(i, j).m_chGround = 'F'; //floor tile
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecBigSlimes.push_back(pos);
           break;
       case 'l':
-          m_chMap[i][j] = 'F'; //floor tile
+          At(i, j).m_chGround = 'F'; //floor tile
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecSlimes.push_back(pos);
           break;
       case 'I': 
-          m_chMap[i][j] = 'F'; //floor tile
+          At(i, j).m_chGround = 'F'; //floor tile
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecKingSlimes.push_back(pos);
           break;
       case 'K':
-          m_chMap[i][j] = 'F'; //floor tile
+          At(i, j).m_chGround = 'F'; //floor tile
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecOakSeeds.push_back(pos);
           break;
       case 'R':
-          m_chMap[i][j] = 'F'; //floor tile
+          At(i, j).m_chGround = 'F'; //floor tile
           pos = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           m_vecRabites.push_back(pos);
           break;
       default:
-          m_chMap[i][j] = c;
+          At(i, j).m_chGround = c;
           break;
       }
 
@@ -411,49 +404,49 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
       switch (direction) {
       case 0: { // default, usually just the first map. only need next portal and player
           if (c == 'P') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vPlayer = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'O') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vExitPortalPosition = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'A') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
           }
       } break;
       case 1: {
           if (c == 'P') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vPlayer = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'O') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vExitPortalPosition = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'Y') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vEntryPortalPosition = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'A') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
           }
       } break;
       case -1: {
           if (c == 'A') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vPlayer = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'O') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vExitPortalPosition = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'Y') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
               m_vEntryPortalPosition = m_fTileSize * Vector2(j + 0.5f, m_nHeight - i - 0.5f);
           }
           if (c == 'P') {
-              m_chMap[i][j] = 'F';
+              At(i, j).m_chGround = 'F';
           }
       } break;
 
@@ -464,17 +457,25 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
     index += 2; //skip end of line character
   } //for
 
+  //derive the flags now that the ground characters are known
+
+  for (STile& tile : m_vecTiles)
+    if (tile.m_chGround == 'W')
+      tile.m_nFlags |= STile::WALL | STile::SOLID;
+    else if (tile.m_chGround == 'X')
+      tile.m_nFlags |= STile::SOLID;
+
   //iterate again now that surrounding chars can be examined
   for (int i = 0; i < m_nHeight; ++i) {
       for (int j = 0; j < m_nWidth; ++j) {
           //set mask values for ground and flavor bit map logic
           //only occurs if one is not provided in mask, ie '0'
-          if (m_chMap[i][j] == 'W') //walls
+          if (At(i, j).m_chGround == 'W') //walls
               SetWallCode(i, j);
-          else if((m_chMap[i][j] == 'B' || m_chMap[i][j] == 'M' || m_chMap[i][j] == 'G' || 
-              m_chMap[i][j] == 'C') && m_chMapMask[i][j] == '0' ) //brown cobble
+          else if((At(i, j).m_chGround == 'B' || At(i, j).m_chGround == 'M' || At(i, j).m_chGround == 'G' || 
+              At(i, j).m_chGround == 'C') && At(i, j).m_chGroundMask == '0' ) //brown cobble
               SetFloorCode(i, j);
-          if (m_chFlavor[i][j] == 'R' && m_chFlavorMask[i][j] == '0')  //rails
+          if (At(i, j).m_chFlavor == 'R' && At(i, j).m_chFlavorMask == '0')  //rails
               SetRailCode(i, j);
       } //for
   } //for
@@ -482,6 +483,13 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
   m_vWorldSize = Vector2((float)m_nWidth, (float)m_nHeight)*m_fTileSize;
   MakeBoundingBoxes();
 
+  //empty render chunks, resolved when they first come into view
+
+  m_nChunksWide = (m_nWidth + CHUNK_SIZE - 1)/CHUNK_SIZE;
+  m_nChunksHigh = (m_nHeight + CHUNK_SIZE - 1)/CHUNK_SIZE;
+  m_vecChunks.clear();
+  m_vecChunks.resize(m_nChunksWide*m_nChunksHigh);
+
   //clean up
   delete [] buffer; 
   delete[] bufferMapMask;
@@ -490,86 +498,86 @@ void CTileManager::LoadMap(char* filename, char* mapmaskname, char* flavorname,
 } //LoadMap
 
 /// <summary>
-/// Populates ground map with (UINT, SpriteDesc) associations
+/// Populates the ground table with (char, mask frame) -> sprite associations
 /// </summary>
 void CTileManager::InitializeGroundMap() {
     LSpriteDesc2D spriteDesc;
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Floor1, Vector2::Zero);
     spriteDesc.m_nCurrentFrame = (UINT)0;
-    groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'F' * (UINT)'F'), spriteDesc));
+    SetSprite(m_sGroundTable, 'F', 0, spriteDesc);
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::BrownCobbleFloor, Vector2::Zero);
     for (UINT i = 0; i < 9; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'B' * (UINT)'B') + i, spriteDesc));
+        SetSprite(m_sGroundTable, 'B', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::MarshGrassFloor, Vector2::Zero);
     for (UINT i = 0; i < 9; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'M' * (UINT)'M') + i, spriteDesc));
+        SetSprite(m_sGroundTable, 'M', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::GrassGroundFloor2, Vector2::Zero);
     for (UINT i = 0; i < 9; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'G' * (UINT)'G') + i, spriteDesc));
+        SetSprite(m_sGroundTable, 'G', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::GreenCobbleFloor, Vector2::Zero);
     for (UINT i = 0; i < 9; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'C' * (UINT)'C') + i, spriteDesc));
+        SetSprite(m_sGroundTable, 'C', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::WallOut1, Vector2::Zero);
     for (UINT i = 0; i < 9; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'W' * (UINT)'W') + i, spriteDesc));
+        SetSprite(m_sGroundTable, 'W', i, spriteDesc);
     }
 
 
     spriteDesc.m_nCurrentFrame = (UINT)9;
     spriteDesc.m_vPos = Vector2(18.0f, 18.0f);
-    groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'W' * (UINT)'W') + 9, spriteDesc));  //ascii ':'
+    SetSprite(m_sGroundTable, 'W', 9, spriteDesc);  //ascii ':'
 
     spriteDesc.m_nCurrentFrame = (UINT)10;
     spriteDesc.m_vPos = Vector2(-18.0f, 18.0f);
-    groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'W' * (UINT)'W') + 10, spriteDesc)); //';'
+    SetSprite(m_sGroundTable, 'W', 10, spriteDesc); //';'
 
     spriteDesc.m_nCurrentFrame = (UINT)9;
     spriteDesc.m_vPos = Vector2(-18.0f, -18.0f);
     spriteDesc.m_fRoll = -XM_PI;
-    groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'W' * (UINT)'W') + 11, spriteDesc)); //'<'
+    SetSprite(m_sGroundTable, 'W', 11, spriteDesc); //'<'
 
     spriteDesc.m_nCurrentFrame = (UINT)10;
     spriteDesc.m_vPos = Vector2(18.0f, -18.0f);
     spriteDesc.m_fRoll = -XM_PI;
-    groundMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'W' * (UINT)'W') + 12, spriteDesc)); //'='
+    SetSprite(m_sGroundTable, 'W', 12, spriteDesc); //'='
 
 
 }
 
 /// <summary>
-/// Populates flavor map with (UINT, SpriteDesc) associations
+/// Populates the flavor table with (char, mask frame) -> sprite associations
 /// </summary>
 void CTileManager::InitializeFlavorValMap() {
     LSpriteDesc2D spriteDesc = LSpriteDesc2D((UINT)eSprite::Shrooms, Vector2::Zero);
     for (UINT i = 0; i < 8; i++) {  //mushrooms
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'m' * (UINT)'m') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'm', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Fern, Vector2::Zero);
     for (UINT i = 0; i < 6; i++) {  //little fern 
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'f' * (UINT)'f') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'f', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::BigFern, Vector2::Zero);
     for (UINT i = 0; i < 3; i++) {  //big fern 
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'F' * (UINT)'F') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'F', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Rails, Vector2::Zero);
@@ -577,65 +585,65 @@ void CTileManager::InitializeFlavorValMap() {
     spriteDesc.m_fYScale = 2.24f;
     for (UINT i = 0; i < 12; i++) {  //smart rails 
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'R' * (UINT)'R') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'R', i, spriteDesc);
     }
     spriteDesc.m_fXScale = spriteDesc.m_fYScale = 1.0f;
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Grass1, Vector2::Zero);
     for (UINT i = 0; i < 8; i++) {   
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'o' * (UINT)'o') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'o', i, spriteDesc);
     }
     spriteDesc = LSpriteDesc2D((UINT)eSprite::TallGrass1, Vector2::Zero);
     for (UINT i = 0; i < 4; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'O' * (UINT)'O') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'O', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Grass2, Vector2::Zero);
     for (UINT i = 0; i < 8; i++) {   
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'p' * (UINT)'p') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'p', i, spriteDesc);
     }
     spriteDesc = LSpriteDesc2D((UINT)eSprite::TallGrass2, Vector2::Zero);
     for (UINT i = 0; i < 4; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'P' * (UINT)'P') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'P', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Grass3, Vector2::Zero);
     for (UINT i = 0; i < 8; i++) {  
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'c' * (UINT)'c') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'c', i, spriteDesc);
     }
     spriteDesc = LSpriteDesc2D((UINT)eSprite::TallGrass3, Vector2::Zero);
     for (UINT i = 0; i < 4; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'C' * (UINT)'C') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'C', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Grass4, Vector2::Zero);
     for (UINT i = 0; i < 8; i++) {   
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'b' * (UINT)'b') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'b', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::TallGrass4, Vector2::Zero);
     for (UINT i = 0; i < 4; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'B' * (UINT)'B') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'B', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::BrownGravel, Vector2::Zero);
     for (UINT i = 0; i < 4; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'G' * (UINT)'G') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'G', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::GreyGravel, Vector2::Zero);
     for (UINT i = 0; i < 4; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'g' * (UINT)'g') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'g', i, spriteDesc);
     }
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Lantern, Vector2::Zero);
@@ -643,7 +651,7 @@ void CTileManager::InitializeFlavorValMap() {
     spriteDesc.m_vPos.y += 8.0f;
     for (UINT i = 0; i < 9; i++) {
         spriteDesc.m_nCurrentFrame = (UINT)i;
-        flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'L' * (UINT)'L') + i, spriteDesc));
+        SetSprite(m_sFlavorTable, 'L', i, spriteDesc);
     }
 
 
@@ -651,18 +659,18 @@ void CTileManager::InitializeFlavorValMap() {
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Support1, Vector2::Zero);
     spriteDesc.m_fXScale = spriteDesc.m_fYScale = 1.2f;
     spriteDesc.m_vPos.y -= 5.0f;
-    flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'S' * (UINT)'S'), spriteDesc));
+    SetSprite(m_sFlavorTable, 'S', 0, spriteDesc);
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::Support2, Vector2::Zero);
     spriteDesc.m_fXScale = spriteDesc.m_fYScale = 1.2f;
     spriteDesc.m_vPos.y -= 5.0f;
-    flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'S' * (UINT)'S') + 1, spriteDesc));
+    SetSprite(m_sFlavorTable, 'S', 1, spriteDesc);
 
     spriteDesc = LSpriteDesc2D((UINT)eSprite::RailStop, Vector2::Zero);
     spriteDesc.m_nCurrentFrame = (UINT)0;
     spriteDesc.m_fXScale = 2.24f;
     spriteDesc.m_fYScale = 2.24f;
-    flavorValMap.insert(std::pair<UINT, LSpriteDesc2D>(UINT((UINT)'-' * (UINT)'-'), spriteDesc));
+    SetSprite(m_sFlavorTable, '-', 0, spriteDesc);
 
 
 }
@@ -685,7 +693,7 @@ void CTileManager::InitializeFlavorValMap() {
 void CTileManager::SetWallCode(const int i, const int j) {
     char value = '0';
     LSpriteDesc2D sprite;
-    if (m_chMap[i][j] == 'W')
+    if (At(i, j).m_chGround == 'W')
     {
         int offset;
         int x, y;
@@ -709,7 +717,7 @@ void CTileManager::SetWallCode(const int i, const int j) {
                 }
 
                 else {  //not self
-                    if (m_chMap[i + x][j + y] == 'W' || m_chMap[i + x][j + y] == 'X')
+                    if (At(i + x, j + y).m_nFlags & STile::SOLID)
                         switch (k - offset) {
                             //didn't use a bool Arr to improve readability and usability
                         case 2: A = true; break;
@@ -777,7 +785,7 @@ void CTileManager::SetWallCode(const int i, const int j) {
         } //else
 
     } //if
-    m_chMapMask[i][j] = value;
+    At(i, j).m_chGroundMask = value;
 } //SetWallCode
 
 /// <summary>
@@ -787,7 +795,7 @@ void CTileManager::SetWallCode(const int i, const int j) {
 /// <param name="j">: y index for mask data and flavor arr</param>
 void CTileManager::SetFloorCode(const int i, const int j) {
     char value = '0';
-    const char c = m_chMap[i][j];
+    const char c = At(i, j).m_chGround;
     int offset;
     int x, y;
     bool B, D, E, G;
@@ -796,7 +804,7 @@ void CTileManager::SetFloorCode(const int i, const int j) {
     offset = 0;
     //check if edge of map
     if (i == (m_nHeight - 1) || j == (m_nWidth - 1) || i == 0 || j == 0)
-        m_chMap[i][j] = value;
+        At(i, j).m_chGround = value;
 
     else {
         //check surrounding tiles for walls and generate code
@@ -808,7 +816,7 @@ void CTileManager::SetFloorCode(const int i, const int j) {
                 offset = 1;
 
             else {  //not self
-                if (m_chMap[i + x][j + y] == c) //check if adj char is this floor 
+                if (At(i + x, j + y).m_chGround == c) //check if adj char is this floor 
                     switch (k - offset) {
                     case 1: B = true; break;
                     case 3: E = true; break;
@@ -837,7 +845,7 @@ void CTileManager::SetFloorCode(const int i, const int j) {
         else if (B && !D && E && !G)
             value = '9';
     } //else
-    m_chMapMask[i][j] = value;   //assign floor 'index'
+    At(i, j).m_chGroundMask = value;   //assign floor 'index'
 } //SetFloorCode
 
 /// <summary>
@@ -855,7 +863,7 @@ void CTileManager::SetRailCode(const int i, const int j) {
     offset = 0;
     //check if edge of map
     if (i == (m_nHeight - 1) || j == (m_nWidth - 1) || i == 0 || j == 0)
-        m_chFlavorMask[i][j] = value;
+        At(i, j).m_chFlavorMask = value;
 
     else {
         //check surrounding tiles for walls and generate code
@@ -867,7 +875,7 @@ void CTileManager::SetRailCode(const int i, const int j) {
                 offset = 1;
 
             else {  //not self
-              if (m_chFlavor[i + x][j + y] == 'R') //check if adj char is rail 
+              if (At(i + x, j + y).m_chFlavor == 'R') //check if adj char is rail 
                 switch (k - offset) {
                     case 1: B = true; break;
                     case 3: E = true; break;
@@ -892,7 +900,7 @@ void CTileManager::SetRailCode(const int i, const int j) {
         else if (D || E)
             value = '4';
     } //else
-    m_chFlavorMask[i][j] = value;   //assign flavor code
+    At(i, j).m_chFlavorMask = value;   //assign flavor code
 } //SetRailCode
 
 
@@ -926,88 +934,156 @@ void CTileManager::DrawBoundingBoxes(eSprite t){
     m_pRenderer->DrawBoundingBox(t, p);
 } //DrawBoundingBoxes
 
-/// Draw order is top-down, left-to-right so that the image
-/// agrees with the map text file viewed in NotePad.
-void CTileManager::Draw(){
-    std::string s;
-  LSpriteDesc2D desc; //sprite descriptors for tiles
+/// Resolve the sprites for the tiles in a render chunk. Tile appearance
+/// doesn't change unless a tile is invalidated, so this is done when the
+/// chunk first comes into view and the result is reused after that.
+/// \param ci Chunk row, top row first.
+/// \param cj Chunk column.
+
+void CTileManager::BakeChunk(size_t ci, size_t cj){
+  SChunk& chunk = m_vecChunks[ci*m_nChunksWide + cj];
+  chunk.m_vecSprites.clear();
+  chunk.m_vecOverSprites.clear();
+
+  size_t k = 0; //tile index within chunk
+
+  for(size_t i=ci*CHUNK_SIZE; i<(ci + 1)*CHUNK_SIZE; i++)
+    for(size_t j=cj*CHUNK_SIZE; j<(cj + 1)*CHUNK_SIZE; j++){
+      chunk.m_nFirst[k] = (UINT)chunk.m_vecSprites.size();
+      chunk.m_nOverFirst[k] = (UINT)chunk.m_vecOverSprites.size();
+
+      if(i < m_nHeight && j < m_nWidth) //chunks on the far edges may be partly off the map
+        BakeTile(i, j, chunk.m_vecSprites, chunk.m_vecOverSprites);
+
+      k++;
+    } //for
+
+  chunk.m_nFirst[k] = (UINT)chunk.m_vecSprites.size();
+  chunk.m_nOverFirst[k] = (UINT)chunk.m_vecOverSprites.size();
+  chunk.m_bValid = true;
+} //BakeChunk
+
+/// Resolve the sprites for one tile, which is between one and four floor and
+/// wall sprites in the order that they are to be drawn, plus a supporting
+/// wall and flavor to be drawn over the objects.
+/// \param i Row, top row first.
+/// \param j Column.
+/// \param under [out] Floor and wall sprites are appended to this.
+/// \param over [out] Supporting wall and flavor sprites are appended to this.
+
+void CTileManager::BakeTile(size_t i, size_t j,
+  std::vector<LSpriteDesc2D>& under, std::vector<LSpriteDesc2D>& over)
+{
+  const STile& tile = At(i, j); //the tile
+  const Vector2 pos((j + 0.5f)*m_fTileSize, (m_nHeight - 1 - i + 0.5f)*m_fTileSize); //tile center
+
+  LSpriteDesc2D desc = LSpriteDesc2D((UINT)eSprite::WallOut1/* + (wallSpriteSheet * 6)*/, pos); //sprite for tile
+  desc.m_nCurrentFrame = 0;
 
+  LSpriteDesc2D floor = LSpriteDesc2D((UINT)eSprite::GrassGroundFloor, pos); //floor tile
+  floor.m_nCurrentFrame = (UINT)4; //TODO make it ez to replace base floor
+
+  LSpriteDesc2D darkspace = LSpriteDesc2D((UINT)eSprite::WallOut1, pos); //dark tile
+  darkspace.m_nCurrentFrame = (UINT)4;
+
+  if (i == (m_nHeight - 1) || j == (m_nWidth - 1) || i == 0 || j == 0)
+      desc.m_nCurrentFrame = (UINT)4; //if on edge tile is void
+  else {
+      switch (tile.m_chGround) { //select which frame of the tile sprite is to be drawn
+      case 'B': //draw base floor under top-layer //TODO other floors
+      case 'M':
+      case 'G':
+      case 'C':
+      case 'F': //draw base floor at F
+          under.push_back(floor);
+          break; //floor
+      case 'X': under.push_back(darkspace); break; //BLACKNESS
+      default:
+          desc.m_nCurrentFrame = (UINT)4; break; //error tile
+      } //switch
+  } //else 
+
+  /*Check for char - mask matches in the ground table. Handle cases where extra sprites are
+  needed. Bake match if one is found */
+  if (tile.m_chGroundMask != '0') {
+      GetGroundSprite(&desc, tile.m_chGround, tile.m_chGroundMask);
+      under.push_back(floor);    //draw floor under walls
+
+      if (tile.m_chGround == 'W') {
+          if (tile.m_chGroundMask > '9')  //check for corners - need dark below them (rather than floor)
+              under.push_back(darkspace);
+          else if (tile.m_chGroundMask > '6')   //check for bottom walls - need surface below
+              BakeSupportingWalls(&desc, tile.m_chGroundMask, over); //wall surfaces
+      } //if
+      under.push_back(desc); //floor/wall tile
+  } //if
+
+  /*Check for char - mask matches in the flavor table. Offset is relative to the ground sprite*/
+  if (tile.m_chFlavorMask != '0' &&
+    GetFlavorSprite(&desc, tile.m_chFlavor, tile.m_chFlavorMask) != -1)
+      over.push_back(desc);    //flavor stuff is drawn later
+} //BakeTile
+
+/// Get the range of rows and columns that are visible in the window, with a
+/// border of extra tiles.
+/// \param top [out] Index of top row.
+/// \param bottom [out] Index of bottom row.
+/// \param left [out] Index of left column.
+/// \param right [out] Index of right column.
+
+void CTileManager::GetVisibleTiles(int& top, int& bottom, int& left, int& right) const{
   const int w = (int)ceil(m_nWinWidth/m_fTileSize) + 2; //width of window in tiles, with 2 extra
   const int h = (int)ceil(m_nWinHeight/m_fTileSize) + 2; //height of window in tiles, with 2 extra
 
   const Vector2 campos = m_pRenderer->GetCameraPos(); //camera position
   const Vector2 origin = campos + 0.5f*m_nWinWidth*Vector2(-1.0f, 1.0f); //position of top left corner of window
 
-  const int top = std::max(0, (int)m_nHeight - (int)round(origin.y/m_fTileSize) + 1); //index of top tile
-  const int bottom = std::min(top + h + 1, (int)m_nHeight - 1); //index of bottom tile
+  top = std::max(0, (int)m_nHeight - (int)round(origin.y/m_fTileSize) + 1); //index of top tile
+  bottom = std::min(top + h + 1, (int)m_nHeight - 1); //index of bottom tile
 
-  const int left = std::max(0, (int)round(origin.x/m_fTileSize) - 1); //index of left tile
-  const int right = std::min(left + w, (int)m_nWidth - 1); //index of right tile
+  left = std::max(0, (int)round(origin.x/m_fTileSize) - 1); //index of left tile
+  right = std::min(left + w, (int)m_nWidth - 1); //index of right tile
+} //GetVisibleTiles
 
-  LSpriteDesc2D floor = LSpriteDesc2D((UINT)eSprite::GrassGroundFloor, Vector2::Zero); //floor tile
-  floor.m_nCurrentFrame = (UINT)4; //TODO make it ez to replace base floor
+/// Draw order is top-down, left-to-right so that the image
+/// agrees with the map text file viewed in NotePad. Render chunks
+/// that come into view for the first time or have been invalidated
+/// are resolved, and the others are reused as they are.
 
-  LSpriteDesc2D darkspace = LSpriteDesc2D((UINT)eSprite::WallOut1, Vector2::Zero); //dark tile
-  darkspace.m_nCurrentFrame = (UINT)4;
+void CTileManager::Draw(){
+  if(m_vecChunks.empty())return; //no map
 
-  for (int i = top; i <= bottom; i++) {//for each column
-      for (int j = left; j <= right; j++) { //for each row    
-          desc.m_nSpriteIndex = ((UINT)eSprite::WallOut1/* + (wallSpriteSheet * 6)*/); //sprite index for tile
-          desc.m_nCurrentFrame = 0;
-          desc.m_vPos.x = (j + 0.5f) * m_fTileSize; //horizontal component of tile position
-          desc.m_vPos.y = (m_nHeight - 1 - i + 0.5f) * m_fTileSize; //vertical component of tile position
-
-          floor.m_vPos = desc.m_vPos;
-          darkspace.m_vPos = desc.m_vPos;
-
-          if (i == (m_nHeight - 1) || j == (m_nWidth - 1) || i == 0 || j == 0)
-              desc.m_nCurrentFrame = (UINT)4; //if on edge tile is void
-          else {
-              switch (m_chMap[i][j]) { //select which frame of the tile sprite is to be drawn
-              case 'B': //draw base floor under top-layer //TODO other floors
-              case 'M':
-              case 'G':
-              case 'C':
-              case 'F': //draw base floor at F
-                  m_pRenderer->Draw(&floor);
-                  break; //floor
-              case 'X': m_pRenderer->Draw(&darkspace); break; //BLACKNESS
-              default:
-                  desc.m_nCurrentFrame = (UINT)4; break; //error tile
-              } //switch
-          } //else 
-
-          /*Check for char - mask matches in groundMap. Handle cases where extra sprites are
-          needed. Draw match if one is found */
-          if (m_chMapMask[i][j] != '0' &&
-              GetGroundSprite(&desc, m_chMap[i][j], m_chMapMask[i][j]) != '0') {
-                m_pRenderer->Draw(&floor);    //draw floor under walls
-
-              if (m_chMap[i][j] == 'W') {
-                  if (m_chMapMask[i][j] > '9')  //check for corners - need dark below them (rather than floor)
-                      m_pRenderer->Draw(&darkspace);  
-                  else if (m_chMapMask[i][j] > '6')   //check for bottom walls - need surface below
-                      DrawSupportingWalls(&desc, m_chMapMask[i][j]); //draw wall surfaces
-              } //if
-              m_pRenderer->Draw(&desc); //draw floor/wall tile
-
-          } //if
-
-          /*Check for char - mask matches in flavorMap. Draw match if one is found*/
-          if (m_chFlavorMask[i][j] != '0' && 
-            GetFlavorSprite(&desc, m_chFlavor[i][j], m_chFlavorMask[i][j]) != -1)
-              m_vecDrawOver.push_back(desc);    //store flavor stuff to be drawn later
+  const auto start = std::chrono::high_resolution_clock::now(); //start time
 
-      } //for
-  } //for
+  int top, bottom, left, right; //visible tiles
+  GetVisibleTiles(top, bottom, left, right);
+
+  if(top <= bottom && left <= right){
+    for(size_t ci=top/CHUNK_SIZE; ci<=bottom/CHUNK_SIZE; ci++) //for each visible chunk row
+      for(size_t cj=left/CHUNK_SIZE; cj<=right/CHUNK_SIZE; cj++) //for each visible chunk column
+        if(m_vecChunks[ci*m_nChunksWide + cj].m_bValid)
+          m_nChunkHits++;
+
+        else{
+          BakeChunk(ci, cj);
+          m_nChunkMisses++;
+        } //else
+
+    DrawChunks(false);
+  } //if
+
+  const std::chrono::duration<float, std::milli> ms =
+      std::chrono::high_resolution_clock::now() - start; //time taken
+  m_fDrawTime = ms.count();
 } //Draw
 
 /// <summary>
-/// 
+/// Bake the wall surface below a bottom wall, to be drawn over the objects.
 /// </summary>
-/// <param name="wallDesc"></param>
-/// <param name="maskVal"></param>
-void CTileManager::DrawSupportingWalls(const LSpriteDesc2D* wallDesc, const char maskVal) {
+/// <param name="wallDesc">wall sprite</param>
+/// <param name="maskVal">wall bitmap code</param>
+/// <param name="over">sprites drawn over the objects</param>
+void CTileManager::BakeSupportingWalls(const LSpriteDesc2D* wallDesc, const char maskVal, std::vector<LSpriteDesc2D>& over) {
     LSpriteDesc2D support = *wallDesc;
     support.m_vPos += Vector2(0.0f, -46.0f);
     support.m_fXScale = 1.125f;
@@ -1027,170 +1103,383 @@ void CTileManager::DrawSupportingWalls(const LSpriteDesc2D* wallDesc, const char
         return;
         break;
     }
-    m_vecDrawOver.push_back(support);
+    over.push_back(support);
+}
+
+/// <summary>
+/// Put a sprite into a lookup table. Only the fields that the draw
+/// functions copy out are kept.
+/// </summary>
+/// <param name="table">ground or flavor table</param>
+/// <param name="c">map char</param>
+/// <param name="n">mask frame, '1' in the mask file is frame 0</param>
+/// <param name="desc">sprite to associate with them</param>
+void CTileManager::SetSprite(CTileSpriteTable& table, const char c, const UINT n, const LSpriteDesc2D& desc) {
+    if (n >= NUM_MASK_FRAMES)
+        ABORT("Mask frame %u is too big for the sprite table.", n);
+
+    STileSprite& entry = table[(unsigned char)c][n];
+    entry.m_nSpriteIndex = desc.m_nSpriteIndex;
+    entry.m_nCurrentFrame = desc.m_nCurrentFrame;
+    entry.m_vOffset = desc.m_vPos;
+    entry.m_fXScale = desc.m_fXScale;
+    entry.m_fYScale = desc.m_fYScale;
+    entry.m_fRoll = desc.m_fRoll;
+    entry.m_bValid = true;
+}
+
+/// <summary>
+/// Copy a sprite out of a lookup table if one exists. This is a single
+/// indexed load, with no search.
+/// </summary>
+/// <param name="table">ground or flavor table</param>
+/// <param name="desc">sprite descriptor with the tile position already set</param>
+/// <param name="c">map char</param>
+/// <param name="m">mask char</param>
+/// <returns>0 on success. -1 on no match</returns>
+int CTileManager::GetSprite(const CTileSpriteTable& table, LSpriteDesc2D* desc, const char c, const char m) {
+    const UINT n = (UINT)(unsigned char)m - (UINT)'1'; //convert ascii char to frame number: '1' => 0, '0' wraps
+    if (n >= NUM_MASK_FRAMES) //no mask, or not a frame
+        return -1;
+
+    const STileSprite& entry = table[(unsigned char)c][n];
+    if (!entry.m_bValid) //match not found
+        return -1; //check for -1 in caller - desc not set to sprite
+
+    desc->m_nSpriteIndex = entry.m_nSpriteIndex;
+    desc->m_vPos += entry.m_vOffset; //add offset, don't copy
+    desc->m_nCurrentFrame = entry.m_nCurrentFrame;
+    desc->m_fXScale = entry.m_fXScale;
+    desc->m_fYScale = entry.m_fYScale;
+    desc->m_fRoll = entry.m_fRoll;
+    return 0;
 }
 
 /// <summary>
-/// Get sprite from ground map if one exists.
+/// Get sprite from ground table if one exists.
 /// </summary>
 /// <param name="desc"></param>
-/// <param name="c">flavor char</param>
+/// <param name="c">ground char</param>
 /// <param name="m">mask char</param>
 /// <returns>0 on success. -1 on no match</returns>
 int CTileManager::GetGroundSprite(LSpriteDesc2D* desc, const char c, const char m) {
-    UINT n = m - (UINT)49;   //convert ascii char to int
-    auto it = groundMap.find((UINT((UINT)c * (UINT)c) + n)); //check for matching sprite in map
-    if (it != groundMap.end()) { //match found
-        //copy everything from mapped sprite - forgot why I did it this way. but I don't wanna break it
-        desc->m_nSpriteIndex = groundMap.at((UINT((UINT)c * (UINT)c) + n)).m_nSpriteIndex;
-        desc->m_vPos += groundMap.at((UINT((UINT)c * (UINT)c) + n)).m_vPos; //add offset, don't copy
-        desc->m_nCurrentFrame = groundMap.at((UINT((UINT)c * (UINT)c) + n)).m_nCurrentFrame;
-        desc->m_fXScale = groundMap.at((UINT((UINT)c * (UINT)c) + n)).m_fXScale;
-        desc->m_fYScale = groundMap.at((UINT((UINT)c * (UINT)c) + n)).m_fYScale;
-        desc->m_fRoll = groundMap.at((UINT((UINT)c * (UINT)c) + n)).m_fRoll;
-        return 0;
-    }
-    else //match not found
-        return -1; //check for -1 in caller - desc not set to sprite
+    return GetSprite(m_sGroundTable, desc, c, m);
 }
 
 /// <summary>
-/// Get sprite from flavor map if one exists.
+/// Get sprite from flavor table if one exists.
 /// </summary>
 /// <param name="desc"></param>
 /// <param name="c">flavor char</param>
 /// <param name="m">mask char</param>
 /// <returns>0 on success. -1 on no match</returns>
 int CTileManager::GetFlavorSprite(LSpriteDesc2D *desc, const char c, const char m) {
-    UINT n = m - (UINT)49;   //convert ascii char to frame number: '1' => 0
-    auto it = flavorValMap.find((UINT((UINT)c * (UINT)c) + n)); //check for matching sprite in map
-    if (it != flavorValMap.end()) { //match found
-        //copy everything from mapped sprite - forgot why I did it this way. but I don't wanna break it
-        desc->m_nSpriteIndex = flavorValMap.at((UINT((UINT)c * (UINT)c) + n)).m_nSpriteIndex;   
-        desc->m_vPos += flavorValMap.at((UINT((UINT)c * (UINT)c) + n)).m_vPos;  //add offset, don't copy
-        desc->m_nCurrentFrame = flavorValMap.at((UINT((UINT)c * (UINT)c) + n)).m_nCurrentFrame;
-        desc->m_fXScale = flavorValMap.at((UINT((UINT)c * (UINT)c) + n)).m_fXScale;
-        desc->m_fYScale = flavorValMap.at((UINT((UINT)c * (UINT)c) + n)).m_fYScale;
-        desc->m_fRoll = flavorValMap.at((UINT((UINT)c * (UINT)c) + n)).m_fRoll;
-        return 0;
-    }
-    else //match not found
-        return -1;  //check for -1 in caller - desc not set to sprite
+    return GetSprite(m_sFlavorTable, desc, c, m);
 }
 
+/// Draw the visible part of the render chunks one tile row at a time, so
+/// that sprites which overlap the neighbouring tiles are drawn in the same
+/// order as they would be without chunks. Chunks that haven't been resolved
+/// are skipped.
+/// \param bOver true to draw the sprites that go over the objects, false
+/// to draw the floor and walls.
+
+void CTileManager::DrawChunks(const bool bOver){
+  int top, bottom, left, right; //visible tiles
+  GetVisibleTiles(top, bottom, left, right);
+
+  for(int i=top; i<=bottom; i++){ //for each visible row
+    const size_t ci = i/CHUNK_SIZE; //chunk row
+    const size_t r = i%CHUNK_SIZE; //row within chunk
+
+    for(size_t cj=left/CHUNK_SIZE; cj<=right/CHUNK_SIZE; cj++){ //for each visible chunk in this row
+      const SChunk& chunk = m_vecChunks[ci*m_nChunksWide + cj];
+      if(!chunk.m_bValid)continue;
+
+      const size_t j0 = std::max<size_t>(left, cj*CHUNK_SIZE) - cj*CHUNK_SIZE; //first visible column in chunk
+      const size_t j1 = std::min<size_t>(right + 1, (cj + 1)*CHUNK_SIZE) - cj*CHUNK_SIZE; //one past last
+
+      const UINT* first = bOver? chunk.m_nOverFirst: chunk.m_nFirst; //tile index
+      const std::vector<LSpriteDesc2D>& v = bOver? chunk.m_vecOverSprites: chunk.m_vecSprites; //sprites
+
+      for(UINT k=first[r*CHUNK_SIZE + j0]; k<first[r*CHUNK_SIZE + j1]; k++)
+        m_pRenderer->Draw(&v[k]);
+    } //for
+  } //for
+} //DrawChunks
+
 /// <summary>
-/// Draws everything in m_vecDrawOver then clears it. Called after main draw fn
-/// Draws things on top of the floor and walls. 
+/// Draws the visible supporting walls and flavor on top of the floor, walls
+/// and objects. Called after main draw fn. These come from the render chunks
+/// resolved by Draw(), so nothing is rebuilt per frame.
 /// </summary>
 void CTileManager::DrawOver() {
-    for (auto i : m_vecDrawOver) {
-        m_pRenderer->Draw(&i);
-    }
-    m_vecDrawOver.erase(m_vecDrawOver.begin(), m_vecDrawOver.end());
-
+    if (m_vecChunks.empty())return; //no map
+    DrawChunks(true);
 } //DrawOver
 
+/// Reader function for the tile size.
+/// \return Tile width and height in pixels.
+
+const float CTileManager::GetTileSize() const{
+  return m_fTileSize;
+} //GetTileSize
+
+/// Reader function for the CPU time taken by the last call to `Draw()`,
+/// which includes submitting the sprites to the renderer.
+/// \return Draw time in milliseconds.
+
+const float CTileManager::GetDrawTime() const{
+  return m_fDrawTime;
+} //GetDrawTime
+
+/// Reader function for the number of render chunk hits, that is, the
+/// number of times a visible chunk was drawn from its cached sprites.
+/// \return Number of chunk hits since the program started.
+
+const size_t CTileManager::GetChunkHits() const{
+  return m_nChunkHits;
+} //GetChunkHits
+
+/// Reader function for the number of render chunk misses, that is, the
+/// number of times a visible chunk's sprites had to be resolved.
+/// \return Number of chunk misses since the program started.
+
+const size_t CTileManager::GetChunkMisses() const{
+  return m_nChunkMisses;
+} //GetChunkMisses
+
+/// Mark the render chunk containing a tile as out of date, so that its
+/// sprites are resolved again the next time it is drawn. Call this after
+/// changing a tile, and for any neighbours whose bitmap codes change with it.
+/// \param i Row, top row first.
+/// \param j Column.
+
+void CTileManager::InvalidateTile(size_t i, size_t j){
+  if(i < m_nHeight && j < m_nWidth)
+    m_vecChunks[(i/CHUNK_SIZE)*m_nChunksWide + j/CHUNK_SIZE].m_bValid = false;
+} //InvalidateTile
+
+/// Find how far a triangle reaches left and right within a horizontal band.
+/// The part of the triangle inside the band is a convex polygon whose corners
+/// are the triangle's corners inside the band and the points where the
+/// triangle's edges cross the top and bottom of the band.
+/// \param v Corners of the triangle.
+/// \param y0 Bottom of the band.
+/// \param y1 Top of the band.
+/// \param x0 [out] Leftmost x coordinate of the triangle within the band.
+/// \param x1 [out] Rightmost x coordinate of the triangle within the band.
+/// \return true if the triangle meets the band.
+
+const bool CTileManager::SpanInBand(const Vector3 v[3], float y0, float y1, float& x0, float& x1){
+  x0 = FLT_MAX;
+  x1 = -FLT_MAX;
+
+  for(UINT k=0; k<3; k++){ //for each corner, and the edge from it to the next
+    const Vector3& a = v[k];
+    const Vector3& b = v[(k + 1)%3];
+
+    if(y0 <= a.y && a.y <= y1){ //corner inside band
+      x0 = std::min(x0, a.x);
+      x1 = std::max(x1, a.x);
+    } //if
+
+    for(const float y: {y0, y1}) //edge crossing the bottom or top of band
+      if(a.y != b.y && std::min(a.y, b.y) <= y && y <= std::max(a.y, b.y)){
+        const float x = a.x + (y - a.y)*(b.x - a.x)/(b.y - a.y);
+        x0 = std::min(x0, x);
+        x1 = std::max(x1, x);
+      } //if
+  } //for
+
+  return x0 <= x1;
+} //SpanInBand
 
 /// Check whether a circle is visible from a point, that is, either the left
 /// or the right side of the object (from the perspective of the point)
 /// has no walls between it and the point. This gives some weird behavior
 /// when the circle is partially hidden by a block, but it doesn't seem
-/// particularly unnatural in practice. It'll do.
+/// particularly unnatural in practice. It'll do. Each side is a thin
+/// triangle from the point to the edge of the circle, and the circle is
+/// hidden only if some wall intersects both triangles. Only the walls in the
+/// wall index for the tiles under the left-hand triangle can do that, so the
+/// tiles are visited row by row across the triangle, and the first wall that
+/// intersects both triangles ends the search.
 /// \param p0 A point.
 /// \param p1 Center of circle.
 /// \param r Radius of circle.
 /// \return true If the circle is visible from the point.
 
 const bool CTileManager::Visible(const Vector2& p0, const Vector2& p1, float r) const{
-  bool visible = true;
+  if(m_vecWallIndex.empty())
+    return true; //no map loaded
 
-  for(auto i=m_vecWalls.begin(); i!=m_vecWalls.end() && visible; i++){
-    Vector2 direction = p0 - p1;
-    direction.Normalize();
-    const Vector2 norm = Vector2(-direction.y, direction.x);
+  Vector2 direction = p0 - p1;
+  direction.Normalize();
+  const Vector2 norm = Vector2(-direction.y, direction.x);
 
-    const float delta = std::min(r, 16.0f);
+  const float delta = std::min(r, 16.0f);
 
-    //left-hand triangle
-    const Vector3 v0(p0);
-    const Vector3 v1(p1 + r*norm);
-    const Vector3 v2(p1 + (r - delta)*norm);
-    
-    //right-hand triangle
-    const Vector3 v3(p1 - r*norm);
-    const Vector3 v4(p1 - (r - delta)*norm);
+  //left-hand triangle
+  const Vector3 v[3] = {Vector3(p0), Vector3(p1 + r*norm), Vector3(p1 + (r - delta)*norm)};
+
+  //right-hand triangle
+  const Vector3 v3(p1 - r*norm);
+  const Vector3 v4(p1 - (r - delta)*norm);
+
+  const float t = m_fTileSize; //shorthand for tile width and height
+  const float e = 0.01f*t; //slack so that walls just touching the triangle are tested
+
+  const float ymin = std::min(v[0].y, std::min(v[1].y, v[2].y)); //bottom of triangle
+  const float ymax = std::max(v[0].y, std::max(v[1].y, v[2].y)); //top of triangle
+
+  const int bottom = std::max(0, (int)floorf((ymin - e)/t));
+  const int top    = std::min((int)m_nHeight - 1, (int)floorf((ymax + e)/t));
+
+  if(++m_nWallQuery == 0){ //stamp wrapped around, so reset stamps
+    std::fill(m_vecWallStamp.begin(), m_vecWallStamp.end(), 0);
+    m_nWallQuery = 1;
+  } //if
+
+  float x0, x1; //extent of triangle in current row
+
+  for(int i=bottom; i<=top; i++){ //for each row under the triangle
+    if(!SpanInBand(v, i*t - e, (i + 1)*t + e, x0, x1))
+      continue; //triangle misses this row
+
+    const int left  = std::max(0, (int)floorf((x0 - e)/t));
+    const int right = std::min((int)m_nWidth - 1, (int)floorf((x1 + e)/t));
+
+    for(int j=left; j<=right; j++) //for each column under the triangle
+      for(const UINT n: m_vecWallIndex[i*m_nWidth + j]){ //for each wall in this tile
+        if(m_vecWallStamp[n] == m_nWallQuery)continue; //already tested
+        m_vecWallStamp[n] = m_nWallQuery;
+
+        const BoundingBox& aabb = m_vecWalls[n]; //shorthand
 
-    visible = !(*i).Intersects(v0, v1, v2) || !(*i).Intersects(v0, v3, v4);
+        if(aabb.Intersects(v[0], v[1], v[2]) && aabb.Intersects(v[0], v3, v4))
+          return false; //this wall hides both sides
+      } //for
   } //for
 
-  return visible;
+  return true;
 } //Visible
 
-/// Check whether a bounding sphere collides with one of the wall bounding boxes.
-/// If so, compute the collision normal and the overlap distance. 
-/// \param s Bounding sphere of object.
+/// Check whether a bounding sphere collides with a wall bounding box.
+/// If so, compute the collision normal and the overlap distance. If the
+/// center of the sphere is inside the wall then there is no sensible normal,
+/// and the normal and overlap distance are left as they are.
+/// \param s0 Bounding sphere of object.
+/// \param aabb Bounding box of wall.
 /// \param norm [out] Collision normal.
 /// \param d [out] Overlap distance.
-/// \return true if the bounding sphere overlaps a wall.
+/// \return true if the bounding sphere overlaps the wall.
 
-const bool CTileManager::CollideWithWall(
-  BoundingSphere s, Vector2& norm, float& d) const
+const bool CTileManager::WallContact(
+  const BoundingSphere& s0, const BoundingBox& aabb, Vector2& norm, float& d) const
 {
-  bool hit = false; //return result, true if there is a collision with a wall
+  Vector3 corner[8]; //for corners of aabb
+  aabb.GetCorners(corner);  //get corners of aabb
+  BoundingSphere s = s0; //local copy
+  s.Center.z = corner[0].z; //make sure they are at the same depth
 
-  for(auto i=m_vecWalls.begin(); i!=m_vecWalls.end() && !hit; i++){
-    const BoundingBox& aabb = *i; //shorthand
+  //the first 4 corners of aabb are the same as the last 4 but with different z
 
-    Vector3 corner[8]; //for corners of aabb
-    aabb.GetCorners(corner);  //get corners of aabb
-    s.Center.z = corner[0].z; //make sure they are at the same depth
+  if(!s.Intersects(aabb)) //includes when they are touching
+    return false;
 
-    //the first 4 corners of aabb are the same as the last 4 but with different z
+  //collision with either a point or an edge
 
-    hit = s.Intersects(aabb); //includes when they are touching
-
-    if(hit){ //collision with either a point or an edge
-      bool bPointCollide = false; //true if colliding with corner of bounding box
+  for(UINT i=0; i<4; i++) //check first 4 corners
+    if(s.Contains(corner[i])){ //collision of bounding sphere with corner
+      Vector3 norm3 = s.Center - corner[i]; //vector from corner to sphere center
+      norm = (Vector2)norm3; //cast to 2D
+      d = s.Radius - norm.Length(); //overlap distance
+      norm.Normalize(); //norm needs to be a unit vector
+      return true;
+    } //if
 
-      for(UINT i=0; i<4 && !bPointCollide; i++) //check first 4 corners
-        if(s.Contains(corner[i])){ //collision of bounding sphere with corner
-          bPointCollide = true;
-          Vector3 norm3 = s.Center - corner[i]; //vector from corner to sphere center
-          norm = (Vector2)norm3; //cast to 2D
-          d = s.Radius - norm.Length(); //overlap distance
-          norm.Normalize(); //norm needs to be a unit vector
-        } //if
+  //edge collide
 
-      if(!bPointCollide){ //edge collide
-        const float fLeft   = corner[0].x; //left of wall
-        const float fRight  = corner[1].x; //right of wall
-        const float fBottom = corner[1].y; //bottom of wall
-        const float fTop    = corner[2].y; //top of wall
+  const float fLeft   = corner[0].x; //left of wall
+  const float fRight  = corner[1].x; //right of wall
+  const float fBottom = corner[1].y; //bottom of wall
+  const float fTop    = corner[2].y; //top of wall
 
-        const float epsilon = 0.01f; //small amount of separation
+  const float epsilon = 0.01f; //small amount of separation
 
-        if(s.Center.x <= fLeft){ //collide with left edge
-          norm = -Vector2::UnitX; //normal
-          d = s.Center.x - fLeft + s.Radius + epsilon; //overlap
-        } //if
+  if(s.Center.x <= fLeft){ //collide with left edge
+    norm = -Vector2::UnitX; //normal
+    d = s.Center.x - fLeft + s.Radius + epsilon; //overlap
+  } //if
 
-        else if(fRight <= s.Center.x){ //collide with right edge
-          norm = Vector2::UnitX; //normal
-          d = fRight - s.Center.x + s.Radius + epsilon; //overlap
-        } //if
+  else if(fRight <= s.Center.x){ //collide with right edge
+    norm = Vector2::UnitX; //normal
+    d = fRight - s.Center.x + s.Radius + epsilon; //overlap
+  } //if
    
-        else if(s.Center.y <= fBottom){ //collide with bottom edge
-          norm = -Vector2::UnitY; //normal
-          d = s.Center.y - fBottom + s.Radius + epsilon; //overlap
-        } //if
+  else if(s.Center.y <= fBottom){ //collide with bottom edge
+    norm = -Vector2::UnitY; //normal
+    d = s.Center.y - fBottom + s.Radius + epsilon; //overlap
+  } //if
 
-        else if(fTop <= s.Center.y){ //collide with top edge
-          norm = Vector2::UnitY; //normal
-          d =  fTop - s.Center.y + s.Radius + epsilon; //overlap
-        } //if 
-      } //if
-    } //if
-  } //for
+  else if(fTop <= s.Center.y){ //collide with top edge
+    norm = Vector2::UnitY; //normal
+    d = fTop - s.Center.y + s.Radius + epsilon; //overlap
+  } //if 
+
+  return true;
+} //WallContact
+
+/// Check whether a bounding sphere collides with a wall, and if so, compute
+/// the collision normal and overlap distance for the first wall in the wall
+/// list that it collides with, which is the one that testing every wall in
+/// order would find. Only the walls in the wall index for the tiles under
+/// the sphere are tested, which for anything smaller than a tile is the 3x3
+/// block of tiles around it. The tiles are widened by a small slack so that
+/// a wall that the sphere only just touches is not missed. The caller
+/// responds to one wall at a time and asks again from the new position.
+/// \param s Bounding sphere of object.
+/// \param norm [out] Collision normal, unchanged if the center is inside the wall.
+/// \param d [out] Overlap distance, unchanged if the center is inside the wall.
+/// \return true if the bounding sphere overlaps a wall.
+
+const bool CTileManager::CollideWithWall(
+  BoundingSphere s, Vector2& norm, float& d) const
+{
+  if(m_vecWallIndex.empty())
+    return false; //no map loaded
+
+  const float t = m_fTileSize; //shorthand for tile width and height
+  const float e = 0.01f*t; //slack
+
+  const int left   = std::max(0, (int)floorf((s.Center.x - s.Radius - e)/t));
+  const int right  = std::min((int)m_nWidth - 1, (int)floorf((s.Center.x + s.Radius + e)/t));
+  const int bottom = std::max(0, (int)floorf((s.Center.y - s.Radius - e)/t));
+  const int top    = std::min((int)m_nHeight - 1, (int)floorf((s.Center.y + s.Radius + e)/t));
+
+  if(++m_nWallQuery == 0){ //stamp wrapped around, so reset stamps
+    std::fill(m_vecWallStamp.begin(), m_vecWallStamp.end(), 0);
+    m_nWallQuery = 1;
+  } //if
+
+  UINT first = (UINT)m_vecWalls.size(); //first wall hit, none yet
+
+  for(int i=bottom; i<=top; i++) //for each row under the sphere
+    for(int j=left; j<=right; j++) //for each column under the sphere
+      for(const UINT n: m_vecWallIndex[i*m_nWidth + j]){ //for each wall in this tile
+        if(n >= first || m_vecWallStamp[n] == m_nWallQuery)continue; //after the first hit, or already tested
+        m_vecWallStamp[n] = m_nWallQuery;
+
+        Vector2 norm0 = norm; //normal for this wall
+        float d0 = d; //overlap for this wall
+
+        if(WallContact(s, m_vecWalls[n], norm0, d0)){ //earliest hit so far
+          first = n;
+          norm = norm0;
+          d = d0;
+        } //if
+      } //for
 
-  return hit;
+  return first < (UINT)m_vecWalls.size();
 } //CollideWithWall
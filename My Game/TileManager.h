@@ -6,7 +6,6 @@
 
 #include <vector>
 #include <random>
-#include <map>
 #include <utility>
 
 #include "Common.h"
@@ -14,6 +13,62 @@
 #include "Sprite.h"
 #include "GameDefines.h"
 
+/// \brief A map tile.
+///
+/// The characters from the four map files for one tile, packed together so
+/// that everything about a tile is in one place, plus flags derived from
+/// them when the map is loaded.
+
+struct STile{
+  char m_chGround = 0; ///< Ground character.
+  char m_chGroundMask = 0; ///< Ground mask character.
+  char m_chFlavor = 0; ///< Flavor character.
+  char m_chFlavorMask = 0; ///< Flavor mask character.
+  UINT8 m_nFlags = 0; ///< Flags derived from the ground character.
+
+  /// \brief Bits in the flags.
+
+  enum : UINT8{
+    WALL  = 1, ///< Ground is a wall.
+    SOLID = 2  ///< Ground is a wall or darkness.
+  }; //enum
+}; //STile
+
+/// \brief Sprite lookup table entry.
+///
+/// The parts of a sprite descriptor selected by a map character and mask
+/// frame, stored in the direct-indexed ground and flavor tables.
+
+struct STileSprite{
+  UINT m_nSpriteIndex = 0; ///< Sprite index.
+  UINT m_nCurrentFrame = 0; ///< Frame number.
+  Vector2 m_vOffset = Vector2::Zero; ///< Offset from the tile center.
+  float m_fXScale = 1.0f; ///< Horizontal scale.
+  float m_fYScale = 1.0f; ///< Vertical scale.
+  float m_fRoll = 0.0f; ///< Orientation.
+  bool m_bValid = false; ///< Whether there is a sprite for this entry.
+}; //STileSprite
+
+const UINT NUM_MASK_FRAMES = 16; ///< Mask frames per character in the sprite tables.
+
+typedef STileSprite CTileSpriteTable[256][NUM_MASK_FRAMES]; ///< Sprites indexed by character and mask frame.
+
+const size_t CHUNK_SIZE = 16; ///< Width and height of a render chunk in tiles.
+
+/// \brief A render chunk.
+///
+/// The resolved sprites for a square block of tiles, grouped by tile in
+/// row-major order with the index of each tile's first sprite, so that the
+/// visible part of each of its rows is one contiguous run.
+
+struct SChunk{
+  std::vector<LSpriteDesc2D> m_vecSprites; ///< Floor and wall sprites.
+  std::vector<LSpriteDesc2D> m_vecOverSprites; ///< Supporting wall and flavor sprites, drawn after the objects.
+  UINT m_nFirst[CHUNK_SIZE*CHUNK_SIZE + 1] = {0}; ///< Index of each tile's first floor and wall sprite, then the end.
+  UINT m_nOverFirst[CHUNK_SIZE*CHUNK_SIZE + 1] = {0}; ///< Index of each tile's first over sprite, then the end.
+  bool m_bValid = false; ///< Whether the sprites are up to date.
+}; //SChunk
+
 /// \brief The tile manager.
 ///
 /// The tile manager is responsible for the tile-based background.
@@ -29,17 +84,28 @@ class CTileManager:
 
     float m_fTileSize = 0.0f; ///< Tile width and height.
 
-    char** m_chMap = nullptr; ///< char arr to store the ground map 
-    char** m_chMapMask = nullptr; ///< char arr to store the ground map mask values
-    char** m_chFlavor = nullptr; ///< char arr to store the flavor txt
-    char** m_chFlavorMask = nullptr; ///< char arr to store the flavor mask
+    std::vector<STile> m_vecTiles; ///< Map tiles in one block, row major, top row first.
+
+    STile& At(size_t, size_t); ///< Get a tile.
+    const STile& At(size_t, size_t) const; ///< Get a tile.
 
-    std::map<UINT, LSpriteDesc2D> groundMap;   ///< associates wall and floor sprites with characters and mapmask values
-    std::map<UINT, LSpriteDesc2D> flavorValMap; ///< associates flavor objects with chars and mask vals
+    CTileSpriteTable m_sGroundTable; ///< Wall and floor sprites indexed by character and mask frame.
+    CTileSpriteTable m_sFlavorTable; ///< Flavor sprites indexed by character and mask frame.
 
-    std::vector<LSpriteDesc2D> m_vecDrawOver; ///< Sprites in here are drawn after the floors and walls
+    static void SetSprite(CTileSpriteTable&, const char, const UINT, const LSpriteDesc2D&); ///< Put a sprite into a table.
+    static int GetSprite(const CTileSpriteTable&, LSpriteDesc2D*, const char, const char); ///< Copy a sprite out of a table.
+
+    std::vector<SChunk> m_vecChunks; ///< Render chunks, row major, top row first.
+    size_t m_nChunksWide = 0; ///< Number of render chunks wide.
+    size_t m_nChunksHigh = 0; ///< Number of render chunks high.
+    size_t m_nChunkHits = 0; ///< Number of times a chunk's cached sprites were reused.
+    size_t m_nChunkMisses = 0; ///< Number of times a chunk's sprites were resolved.
+    float m_fDrawTime = 0.0f; ///< CPU time taken by the last call to Draw(), in milliseconds.
 
     std::vector<BoundingBox> m_vecWalls; ///< AABBs for the walls.
+    std::vector<std::vector<UINT>> m_vecWallIndex; ///< Indices into m_vecWalls of the walls overlapping each tile, bottom row first.
+    mutable std::vector<UINT> m_vecWallStamp; ///< Last query that visited each wall, to avoid testing a wall twice.
+    mutable UINT m_nWallQuery = 0; ///< Current wall query number.
 
     std::vector<Vector2> m_vecTurrets; ///< Turret positions.
     std::vector<Vector2> m_vecSlimes; ///< Slime positions.
@@ -54,9 +120,16 @@ class CTileManager:
     std::vector<Vector2> m_vecSpikes;
 
     void MakeBoundingBoxes(); ///< Make bounding boxes for walls.
+    void MakeWallIndex(); ///< Make the per-tile wall index.
+    const bool WallContact(const BoundingSphere&, const BoundingBox&, Vector2&, float&) const; ///< Circle-wall contact test.
+    static const bool SpanInBand(const Vector3[3], float, float, float&, float&); ///< Horizontal extent of a triangle in a band.
     void SetFloorCode(const int, const int); ///< sets bitmap code for a floor tile
     void SetWallCode(const int, const int); ///< sets bitmap code for a wall tile
     void SetRailCode(const int, const int); ///< sets bitmap code for a rail tile
+    void BakeChunk(size_t, size_t); ///< Resolve the sprites for a render chunk.
+    void BakeTile(size_t, size_t, std::vector<LSpriteDesc2D>&, std::vector<LSpriteDesc2D>&); ///< Resolve the sprites for one tile.
+    void DrawChunks(const bool); ///< Draw the visible part of the render chunks.
+    void GetVisibleTiles(int&, int&, int&, int&) const; ///< Get the range of tiles in the window.
 
   public:
     CTileManager(size_t); ///< Constructor.
@@ -70,16 +143,40 @@ class CTileManager:
 
     int GetGroundSprite(LSpriteDesc2D*, const char, const char); ///< Finds an associated sprite from groundmap and sets the spritedesc to it
     int GetFlavorSprite(LSpriteDesc2D*, const char, const char); ///< Finds an associated sprite from flavormap and sets the spritedesc to it
-    void DrawSupportingWalls(const LSpriteDesc2D*, const char);   ///< draws wall sprites which correspond to a wall's bitmap code
+    void BakeSupportingWalls(const LSpriteDesc2D*, const char, std::vector<LSpriteDesc2D>&);   ///< bakes wall sprites which correspond to a wall's bitmap code
 
-    void DrawOver();    ///< Draws everything in m_vecDrawOver
+    void DrawOver();    ///< Draws the visible supporting walls and flavor
     void DrawBoundingBoxes(eSprite); ///< Draw the bounding boxes.
     void GetObjects(std::vector<Vector2>&, Vector2&, std::vector<Vector2>&, Vector2&, Vector2&,
         std::vector<Vector2>&, std::vector<Vector2>&, std::vector<Vector2>&, std::vector<Vector2>&,
         std::vector<Vector2>&); ///< Get objects.
 
+    const float GetTileSize() const; ///< Get tile width and height.
+    const float GetDrawTime() const; ///< Get CPU time taken by Draw().
+    const size_t GetChunkHits() const; ///< Get number of render chunks reused.
+    const size_t GetChunkMisses() const; ///< Get number of render chunks resolved.
+    void InvalidateTile(size_t, size_t); ///< Mark a tile's render chunk out of date.
+
     const bool Visible(const Vector2&, const Vector2&, float) const; ///< Check visibility.
     const bool CollideWithWall(BoundingSphere, Vector2&, float&) const; ///< Object-wall collision test.
 }; //CTileManager
 
+/// Get a tile from the map.
+/// \param i Row, top row first.
+/// \param j Column.
+/// \return Reference to the tile.
+
+inline STile& CTileManager::At(size_t i, size_t j){
+  return m_vecTiles[i*m_nWidth + j];
+} //At
+
+/// Get a tile from the map.
+/// \param i Row, top row first.
+/// \param j Column.
+/// \return Const reference to the tile.
+
+inline const STile& CTileManager::At(size_t i, size_t j) const{
+  return m_vecTiles[i*m_nWidth + j];
+} //At
+
 #endif //__L4RC_GAME_TILEMANAGER_H__
\ No newline at end of file
@@ -0,0 +1,253 @@
+/// \file TimingWheel.cpp
+/// \brief Code for the timing wheel CTimingWheel.
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+#include "TimingWheel.h"
+
+const float CTimingWheel::TICK = 0.01f;
+
+/// Construct an event that creates a particle.
+/// \param d Particle descriptor.
+/// \param c Budget category of particle.
+
+STimedEvent::STimedEvent(const LParticleDesc2D& d, eParticleCategory c):
+  m_eType(eTimedEvent::Particle), m_cParticle{d, c}{
+} //constructor
+
+/// Construct an event that creates an object.
+/// \param s Sprite type of object.
+/// \param pos Position of object.
+
+STimedEvent::STimedEvent(eSprite s, const Vector2& pos):
+  m_eType(eTimedEvent::Spawn), m_cSpawn{s, pos}{
+} //constructor
+
+/// Construct an event that plays a sound.
+/// \param s Sound.
+
+STimedEvent::STimedEvent(eSound s):
+  m_eType(eTimedEvent::Sound), m_eSound(s){
+} //constructor
+
+/// Construct an event that calls a function.
+/// \param f Function, which is moved into the event.
+
+STimedEvent::STimedEvent(std::function<void()>&& f):
+  m_eType(eTimedEvent::Callback), m_fnCallback(std::move(f)){
+} //constructor
+
+/// Move constructor.
+/// \param e Event to move from.
+
+STimedEvent::STimedEvent(STimedEvent&& e){
+  MoveFrom(std::move(e));
+} //move constructor
+
+/// Move assignment. The old payload is destroyed first because the new one
+/// may be of a different type.
+/// \param e Event to move from.
+/// \return Reference to this event.
+
+STimedEvent& STimedEvent::operator=(STimedEvent&& e){
+  if(this != &e){
+    DestroyPayload();
+    MoveFrom(std::move(e));
+  } //if
+
+  return *this;
+} //operator=
+
+/// Destructor.
+
+STimedEvent::~STimedEvent(){
+  DestroyPayload();
+} //destructor
+
+/// Copy the type and tick of another event and move its payload into this
+/// event's storage, which must not hold a live payload.
+/// \param e Event to move from.
+
+void STimedEvent::MoveFrom(STimedEvent&& e){
+  m_eType = e.m_eType;
+  m_nTick = e.m_nTick;
+
+  switch(m_eType){
+    case eTimedEvent::Particle: new(&m_cParticle) SParticleEvent(e.m_cParticle); break;
+    case eTimedEvent::Spawn: new(&m_cSpawn) SSpawnEvent(e.m_cSpawn); break;
+    case eTimedEvent::Sound: m_eSound = e.m_eSound; break;
+    case eTimedEvent::Callback:
+      new(&m_fnCallback) std::function<void()>(std::move(e.m_fnCallback)); break;
+  } //switch
+} //MoveFrom
+
+/// Destroy the live payload.
+
+void STimedEvent::DestroyPayload(){
+  switch(m_eType){
+    case eTimedEvent::Particle: m_cParticle.~SParticleEvent(); break;
+    case eTimedEvent::Spawn: m_cSpawn.~SSpawnEvent(); break;
+    case eTimedEvent::Sound: break;
+    case eTimedEvent::Callback: m_fnCallback.~function(); break;
+  } //switch
+} //DestroyPayload
+
+/// Convert a delay to a whole number of ticks, rounding up so that an event
+/// never goes off early. The division is done in double precision because
+/// in single precision a long delay can round down to the tick before.
+/// \param t Delay in seconds.
+/// \return Number of ticks.
+
+const UINT64 CTimingWheel::ToTicks(float t){
+  return t > 0.0f? (UINT64)ceil((double)t/TICK): 0;
+} //ToTicks
+
+/// Insert an event into the slot that covers its tick. Which wheel the
+/// slot is in depends on how far in the future the tick is.
+/// \param e Event, which must not be due before the current tick.
+
+void CTimingWheel::Insert(STimedEvent&& e){
+  const UINT64 n = e.m_nTick; //tick that the event is due
+  const UINT64 d = n - m_nNow; //ticks from now
+
+  if(d < SLOTS0)
+    m_vecWheel0[n & (SLOTS0 - 1)].push_back(std::move(e));
+
+  else if(d < ((UINT64)SLOTS0 << BITS))
+    m_vecWheel1[(n >> BITS0) & (SLOTS - 1)].push_back(std::move(e));
+
+  else m_vecWheel2[(n >> (BITS0 + BITS)) & (SLOTS - 1)].push_back(std::move(e));
+} //Insert
+
+/// Empty a slot of the second or third wheel and insert its events again
+/// relative to the current tick, which moves them down a wheel.
+/// \param slot Slot to cascade.
+
+void CTimingWheel::Cascade(std::vector<STimedEvent>& slot){
+  m_vecCascade.swap(slot);
+
+  for(STimedEvent& e: m_vecCascade)
+    Insert(std::move(e));
+
+  m_vecCascade.clear();
+} //Cascade
+
+/// Schedule an event. Events with no delay go off on the next tick.
+/// \param t Delay in seconds of simulation time.
+/// \param e Event to schedule, which is moved into the wheel.
+
+void CTimingWheel::Schedule(float t, STimedEvent&& e){
+  e.m_nTick = m_nNow + std::max<UINT64>(ToTicks(t), 1);
+  Insert(std::move(e));
+  m_nSize++;
+} //Schedule
+
+/// Schedule a particle to be created.
+/// \param t Delay in seconds.
+/// \param d Particle descriptor.
+/// \param c Budget category of particle.
+
+void CTimingWheel::Schedule(float t, const LParticleDesc2D& d, eParticleCategory c){
+  Schedule(t, STimedEvent(d, c));
+} //Schedule
+
+/// Schedule an object to be created.
+/// \param t Delay in seconds.
+/// \param s Sprite type of object.
+/// \param pos Position of object.
+
+void CTimingWheel::Schedule(float t, eSprite s, const Vector2& pos){
+  Schedule(t, STimedEvent(s, pos));
+} //Schedule
+
+/// Schedule a sound to be played.
+/// \param t Delay in seconds.
+/// \param s Sound.
+
+void CTimingWheel::Schedule(float t, eSound s){
+  Schedule(t, STimedEvent(s));
+} //Schedule
+
+/// Schedule a function to be called.
+/// \param t Delay in seconds.
+/// \param f Function, which is moved into the wheel.
+
+void CTimingWheel::Schedule(float t, std::function<void()>&& f){
+  Schedule(t, STimedEvent(std::move(f)));
+} //Schedule
+
+/// Advance the wheel by the whole ticks in a frame's worth of simulation
+/// time, carrying the remainder over to the next frame, moving the events
+/// in each tick's slot onto the end of a batch, and cascading the outer
+/// wheels as the inner wheels wrap around. If no events are scheduled then
+/// the wheel jumps straight to the new tick.
+/// \param dt Frame time in seconds.
+/// \param batch [out] Due events are appended to this.
+
+void CTimingWheel::Advance(float dt, std::vector<STimedEvent>& batch){
+  m_fCarry += std::max<float>(dt, 0.0f);
+  const UINT64 n = (UINT64)(m_fCarry/TICK); //whole ticks elapsed
+  m_fCarry = std::max<float>(m_fCarry - n*TICK, 0.0f);
+  const UINT64 target = m_nNow + n; //new current tick
+
+  if(m_nSize == 0){ //nothing to do
+    m_nNow = std::max<UINT64>(m_nNow, target);
+    return;
+  } //if
+
+  while(m_nNow < target && m_nSize > 0){
+    m_nNow++;
+    const UINT i0 = (UINT)(m_nNow & (SLOTS0 - 1)); //first wheel slot
+
+    if(i0 == 0){ //first wheel wrapped
+      const UINT i1 = (UINT)((m_nNow >> BITS0) & (SLOTS - 1)); //second wheel slot
+
+      if(i1 == 0) //second wheel wrapped
+        Cascade(m_vecWheel2[(m_nNow >> (BITS0 + BITS)) & (SLOTS - 1)]);
+
+      Cascade(m_vecWheel1[i1]);
+    } //if
+
+    std::vector<STimedEvent>& slot = m_vecWheel0[i0]; //due events
+
+    for(STimedEvent& e: slot)
+      batch.push_back(std::move(e));
+
+    m_nSize -= slot.size();
+    slot.clear();
+  } //while
+
+  m_nNow = std::max<UINT64>(m_nNow, target); //in case the wheel emptied early
+} //Advance
+
+/// Remove all of the events.
+
+void CTimingWheel::clear(){
+  for(std::vector<STimedEvent>& slot: m_vecWheel0)slot.clear();
+  for(std::vector<STimedEvent>& slot: m_vecWheel1)slot.clear();
+  for(std::vector<STimedEvent>& slot: m_vecWheel2)slot.clear();
+  m_nSize = 0;
+} //clear
+
+/// Reader function for the current tick.
+/// \return Number of ticks of simulation time so far.
+
+const UINT64 CTimingWheel::GetTick() const{
+  return m_nNow;
+} //GetTick
+
+/// Determine whether there are no events scheduled.
+/// \return true if there are no events.
+
+const bool CTimingWheel::empty() const{
+  return m_nSize == 0;
+} //empty
+
+/// Reader function for the number of events scheduled.
+/// \return Number of events.
+
+const size_t CTimingWheel::size() const{
+  return m_nSize;
+} //size
@@ -0,0 +1,122 @@
+/// \file TimingWheel.h
+/// \brief Interface for the timing wheel CTimingWheel.
+
+#ifndef __L4RC_GAME_TIMINGWHEEL_H__
+#define __L4RC_GAME_TIMINGWHEEL_H__
+
+#include <vector>
+#include <functional>
+
+#include "Particle.h"
+#include "GameDefines.h"
+
+/// \brief Timed event type.
+
+enum class eTimedEvent{
+  Particle, Spawn, Sound, Callback
+}; //eTimedEvent
+
+/// \brief Payload of a timed event that creates a particle.
+
+struct SParticleEvent{
+  LParticleDesc2D m_cDesc; ///< Particle to create.
+  eParticleCategory m_eCategory; ///< Budget category of particle.
+}; //SParticleEvent
+
+/// \brief Payload of a timed event that creates an object.
+
+struct SSpawnEvent{
+  eSprite m_eSprite; ///< Sprite of object to create.
+  Vector2 m_vPos; ///< Position of object to create.
+}; //SSpawnEvent
+
+/// \brief An event scheduled on the timing wheel.
+///
+/// An event can create a particle, create an object, play a sound, or call
+/// an arbitrary function. The payloads share storage in a union tagged by
+/// the event type, so an event is only as large as its largest payload.
+/// Events are moved between the wheel's slots and into the batch of due
+/// events, never copied.
+
+struct STimedEvent{
+  eTimedEvent m_eType; ///< What the event does, and which payload is live.
+  UINT64 m_nTick = 0; ///< Tick on which the event is due.
+
+  union{
+    SParticleEvent m_cParticle; ///< Particle payload.
+    SSpawnEvent m_cSpawn; ///< Spawn payload.
+    eSound m_eSound; ///< Sound to play.
+    std::function<void()> m_fnCallback; ///< Function to call.
+  }; //union
+
+  STimedEvent(const LParticleDesc2D&, eParticleCategory); ///< Particle constructor.
+  STimedEvent(eSprite, const Vector2&); ///< Spawn constructor.
+  explicit STimedEvent(eSound); ///< Sound constructor.
+  explicit STimedEvent(std::function<void()>&&); ///< Callback constructor.
+  STimedEvent(STimedEvent&&); ///< Move constructor.
+  STimedEvent& operator=(STimedEvent&&); ///< Move assignment.
+  ~STimedEvent(); ///< Destructor.
+
+  STimedEvent(const STimedEvent&) = delete; ///< No copying.
+  STimedEvent& operator=(const STimedEvent&) = delete; ///< No copying.
+
+  private:
+    void MoveFrom(STimedEvent&&); ///< Construct the payload from another event's.
+    void DestroyPayload(); ///< Destroy the payload.
+}; //STimedEvent
+
+/// \brief A hierarchical timing wheel.
+///
+/// A scheduler for events that need to happen after a given delay. Time is
+/// simulation time, divided into ticks of fixed length and counted in
+/// integer ticks, so the wheel's clock only moves when the simulation does
+/// and never loses precision however long the game runs. The first wheel has a slot for each
+/// of the next 256 ticks. The second and third wheels have 64 slots each,
+/// covering 256 and 16384 ticks per slot respectively. An event is inserted
+/// in constant time into the slot that covers its tick. When the first
+/// wheel wraps around, the next slot of the second wheel is cascaded down
+/// into it, and likewise from the third wheel into the second. Events too
+/// far in the future for the third wheel wait in it and are cascaded again.
+/// `Advance()` is called once per simulation step with the frame time and
+/// moves all of the events due by then into one batch for the caller to
+/// process.
+
+class CTimingWheel{
+  private:
+    static const UINT BITS0 = 8; ///< Log base 2 of the number of slots in the first wheel.
+    static const UINT BITS = 6; ///< Log base 2 of the number of slots in the other wheels.
+    static const UINT SLOTS0 = 1 << BITS0; ///< Number of slots in the first wheel.
+    static const UINT SLOTS = 1 << BITS; ///< Number of slots in the other wheels.
+
+    std::vector<STimedEvent> m_vecWheel0[SLOTS0]; ///< First wheel, one tick per slot.
+    std::vector<STimedEvent> m_vecWheel1[SLOTS]; ///< Second wheel.
+    std::vector<STimedEvent> m_vecWheel2[SLOTS]; ///< Third wheel.
+    std::vector<STimedEvent> m_vecCascade; ///< Scratch space for cascading.
+
+    UINT64 m_nNow = 0; ///< Last tick processed.
+    float m_fCarry = 0.0f; ///< Simulation time in seconds not yet making up a whole tick.
+    size_t m_nSize = 0; ///< Number of events scheduled.
+
+    void Insert(STimedEvent&&); ///< Insert an event into a slot.
+    void Cascade(std::vector<STimedEvent>&); ///< Reinsert the events in a slot.
+
+  public:
+    static const float TICK; ///< Length of a tick in seconds.
+
+    static const UINT64 ToTicks(float); ///< Convert a delay to ticks.
+
+    void Schedule(float, STimedEvent&&); ///< Schedule an event.
+    void Schedule(float, const LParticleDesc2D&, eParticleCategory); ///< Schedule a particle.
+    void Schedule(float, eSprite, const Vector2&); ///< Schedule an object.
+    void Schedule(float, eSound); ///< Schedule a sound.
+    void Schedule(float, std::function<void()>&&); ///< Schedule a function call.
+
+    void Advance(float, std::vector<STimedEvent>&); ///< Collect the due events.
+    void clear(); ///< Remove all events.
+
+    const UINT64 GetTick() const; ///< Get the current tick.
+    const bool empty() const; ///< Whether there are no events.
+    const size_t size() const; ///< Get number of events.
+}; //CTimingWheel
+
+#endif //__L4RC_GAME_TIMINGWHEEL_H__
@@ -17,26 +17,22 @@ CTurret::CTurret(eSprite t, const Vector2& p): CObject(t, p){
   objType = (UINT)eObjectType::TURRET;
   m_bStatic = true; //turrets are static
   m_fRoll = 0;
-  m_pTowerIdle = new LEventTimer(0.12f);
+  m_cTowerIdle.Start(0.12f);
   m_nCurrentFrame = 0;
 } //constructor
 
 CTurret::~CTurret() {
-  if (m_pTowerIdle) {
-    delete m_pTowerIdle;
-    m_pTowerIdle = nullptr;
-  }
 }
 
 /// Rotate the turret and fire the gun at at the closest available target if
 /// there is one, and rotate the turret at a constant speed otherwise.
 
 void CTurret::move() {
-  if (m_pPlayer) { //safety
-    const float r = ((CTurret*)m_pPlayer)->m_fRadius; //player radius
+  if (m_hPlayer) { //safety
+    const float r = ((CTurret*)m_hPlayer.Get())->m_fRadius; //player radius
 
-    if (m_pTileManager->Visible(m_vPos, m_pPlayer->m_vPos, r)) //player visible
-      RotateTowards(m_pPlayer->m_vPos);
+    if (m_pTileManager->Visible(m_vPos, m_hPlayer->m_vPos, r)) //player visible
+      RotateTowards(m_hPlayer->m_vPos);
   } //if
 
   m_fFacingVector += 0.2f * m_fRotSpeed * XM_2PI * m_pTimer->GetFrameTime(); //rotate
@@ -68,13 +64,13 @@ void CTurret::RotateTowards(const Vector2& pos) {
 
   //fire gun if pointing approximately towards target
 
-  if (fabsf(diff) < fAngleDelta && m_pGunFireEvent->Triggered())
+  if (fabsf(diff) < fAngleDelta && m_cGunFireEvent.Triggered())
     m_pObjectManager->FireGun(this, eSprite::Bullet2);
 } //RotateTowards
 
 void CTurret::UpdateFrameNumber() {
   const UINT n = (UINT)m_pRenderer->GetNumFrames(m_nSpriteIndex); //number of frames
-  if (n > 1 && m_pTowerIdle && m_pTowerIdle->Triggered()) {
+  if (n > 1 && m_cTowerIdle.Triggered()) {
     m_nCurrentFrame = (m_nCurrentFrame + 1) % n;
   }
 }
@@ -15,8 +15,8 @@ class CTurret: public CObject{
     const UINT m_nMaxHealth = 1; ///< Maximum health.
     UINT m_nHealth = m_nMaxHealth; ///< Current health.
 
-    LEventTimer* m_pTowerIdle = nullptr;
-    LEventTimer* m_pTowerDeath = nullptr;
+    CPeriodicTimer m_cTowerIdle;
+    CPeriodicTimer m_cTowerDeath;
     void UpdateFrameNumber();
 
     void RotateTowards(const Vector2&); ///< Swivel towards position.
@@ -15,7 +15,8 @@
 class CTurretBullet : public CObject {
 protected:
 
-  LEventTimer* m_pFireballEvent = nullptr;
+  CPeriodicTimer m_cFireballEvent;
+  float m_fSmokeCarry = 0.0f; ///< Fraction of a smoke particle carried to the next frame.
 
   void UpdateFramenumber();
 